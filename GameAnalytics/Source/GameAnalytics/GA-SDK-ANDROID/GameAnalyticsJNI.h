@@ -5,6 +5,8 @@
 #include <string>
 #include <stdint.h>
 
+class FGAStringSink;
+
 
 namespace gameanalytics {
     extern "C"
@@ -21,6 +23,7 @@ namespace gameanalytics {
         extern void jni_configureGameEngineVersion(const char *gameEngineVersion);
         extern void jni_configureAutoDetectAppVersion(bool flag);
         extern void jni_configureUserId(const char *userId);
+        extern void jni_configure(const char *configuration);
         extern void jni_initialize(const char *gameKey, const char *gameSecret);
 
         extern void jni_addBusinessEventWithReceipt(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType, const char *receipt, const char *store, const char *signature, const char *fields, bool mergeFields);
@@ -47,13 +50,13 @@ namespace gameanalytics {
         extern void jni_startSession();
         extern void jni_endSession();
 
-        extern void jni_getRemoteConfigsValueAsString(const char *key, char** out);
-        extern void jni_getRemoteConfigsValueAsStringWithDefaultValue(const char *key, const char *defaultValue, char** out);
+        extern void jni_getRemoteConfigsValueAsString(const char *key, FGAStringSink& out);
+        extern void jni_getRemoteConfigsValueAsStringWithDefaultValue(const char *key, const char *defaultValue, FGAStringSink& out);
         extern bool jni_isRemoteConfigsReady();
-        extern void jni_getRemoteConfigsContentAsString(char** out);
+        extern void jni_getRemoteConfigsContentAsString(FGAStringSink& out);
 
-        extern void jni_getABTestingId(char** out);
-        extern void jni_getABTestingVariantId(char** out);
+        extern void jni_getABTestingId(FGAStringSink& out);
+        extern void jni_getABTestingVariantId(FGAStringSink& out);
 
         extern void jni_setGAIDTracking(bool value);
 
@@ -4,6 +4,8 @@
 #import <string>
 #import <stdint.h>
 
+class FGAStringSink;
+
 class GameAnalyticsCpp {
 public:
     static void configureAvailableCustomDimensions01(const std::vector<std::string>& list);
@@ -18,6 +20,7 @@ public:
     static void configureUserId(const char *userId);
     static void configureSdkGameEngineVersion(const char *gameEngineSdkVersion);
     static void configureGameEngineVersion(const char *gameEngineVersion);
+    static void configure(const char *configuration);
     static void initialize(const char *gameKey, const char *gameSecret);
 
     static void addBusinessEvent(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType, const char *receipt, const char *fields, bool mergeFields);
@@ -44,13 +47,13 @@ public:
     static void startSession();
     static void endSession();
 
-    static void getRemoteConfigsValueAsString(const char *key, char** out);
-    static void getRemoteConfigsValueAsString(const char *key, const char *defaultValue, char** out);
+    static void getRemoteConfigsValueAsString(const char *key, FGAStringSink& out);
+    static void getRemoteConfigsValueAsString(const char *key, const char *defaultValue, FGAStringSink& out);
     static bool isRemoteConfigsReady();
-    static void getRemoteConfigsContentAsString(char** out);
+    static void getRemoteConfigsContentAsString(FGAStringSink& out);
 
-    static void getABTestingId(char** out);
-    static void getABTestingVariantId(char** out);
+    static void getABTestingId(FGAStringSink& out);
+    static void getABTestingVariantId(FGAStringSink& out);
 
     static void useRandomizedId(bool value);
     static void enableSDKInitEvent(bool value);
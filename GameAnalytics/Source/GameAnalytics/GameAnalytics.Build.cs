@@ -1,6 +1,12 @@
 using UnrealBuildTool;
 using System.IO;
 using System;
+using System.Collections.Generic;
+#if UE_5_0_OR_LATER
+using EpicGames.Core;
+#else
+using Tools.DotNETCommon;
+#endif
 
 
 namespace UnrealBuildTool.Rules
@@ -126,6 +132,108 @@ namespace UnrealBuildTool.Rules
                 string PluginPath = Utils.MakePathRelativeTo(ModuleDirectory, Target.RelativeEnginePath);
                 AdditionalPropertiesForReceipt.Add("AndroidPlugin", Path.Combine(PluginPath, "GameAnalytics_APL.xml"));
             }
+
+#if WITH_FORWARDED_MODULE_RULES_CTOR
+            // The editor always reads the settings from config so they can be edited live
+            if (Target.Type != TargetType.Editor && Target.ProjectFile != null)
+            {
+                BakeProjectSettings(Target);
+            }
+#endif
         }
+
+#if WITH_FORWARDED_MODULE_RULES_CTOR
+        private const string SettingsSection = "/Script/GameAnalyticsEditor.GameAnalyticsProjectSettings";
+
+        // Writes the project settings of the target platform into the binary as definitions read by FAnalyticsGameAnalytics::ReadProjectSettings
+        private void BakeProjectSettings(ReadOnlyTargetRules Target)
+        {
+            ConfigHierarchy Ini = ConfigCache.ReadHierarchy(ConfigHierarchyType.Engine, DirectoryReference.FromFile(Target.ProjectFile), Target.Platform);
+
+            bool bBakeSettings;
+            if (!Ini.GetBool(SettingsSection, "BakeSettingsIntoBinary", out bBakeSettings) || !bBakeSettings)
+            {
+                return;
+            }
+
+            string PlatformPrefix;
+            if (Target.Platform == UnrealTargetPlatform.IOS)
+            {
+                PlatformPrefix = "Ios";
+            }
+            else if (Target.Platform == UnrealTargetPlatform.Android)
+            {
+                PlatformPrefix = "Android";
+            }
+            else if (Target.Platform == UnrealTargetPlatform.Mac)
+            {
+                PlatformPrefix = "Mac";
+            }
+            else if (Target.Platform == UnrealTargetPlatform.Win64)
+            {
+                PlatformPrefix = "Windows";
+            }
+            else
+            {
+                PlatformPrefix = "Linux";
+            }
+
+            PrivateDefinitions.Add("GA_BAKED_SETTINGS=1");
+            AddBakedString(Ini, "GA_BAKED_GAME_KEY", PlatformPrefix + "GameKey", "");
+            AddBakedString(Ini, "GA_BAKED_SECRET_KEY", PlatformPrefix + "SecretKey", "");
+            AddBakedString(Ini, "GA_BAKED_BUILD", PlatformPrefix + "Build", "0.1");
+
+            AddBakedBool(Ini, "GA_BAKED_USE_MANUAL_SESSION_HANDLING", "UseManualSessionHandling", false);
+            AddBakedBool(Ini, "GA_BAKED_AUTO_DETECT_APP_VERSION", "AutoDetectAppVersion", false);
+            AddBakedBool(Ini, "GA_BAKED_DISABLE_DEVICE_INFO", "DisableDeviceInfo", false);
+            AddBakedBool(Ini, "GA_BAKED_USE_ERROR_REPORTING", "UseErrorReporting", true);
+            AddBakedBool(Ini, "GA_BAKED_RECORD_EVENT_AS_SINGLE_DESIGN_EVENT", "RecordEventAsSingleDesignEvent", false);
+            AddBakedBool(Ini, "GA_BAKED_USE_DEFERRED_INITIALIZATION", "UseDeferredInitialization", false);
+            AddBakedBool(Ini, "GA_BAKED_INFO_LOG_BUILD", "InfoLogBuild", true);
+            AddBakedBool(Ini, "GA_BAKED_VERBOSE_LOG_BUILD", "VerboseLogBuild", false);
+
+            AddBakedList(Ini, "GA_BAKED_CUSTOM_DIMENSIONS_01", "CustomDimensions01");
+            AddBakedList(Ini, "GA_BAKED_CUSTOM_DIMENSIONS_02", "CustomDimensions02");
+            AddBakedList(Ini, "GA_BAKED_CUSTOM_DIMENSIONS_03", "CustomDimensions03");
+            AddBakedList(Ini, "GA_BAKED_RESOURCE_CURRENCIES", "ResourceCurrencies");
+            AddBakedList(Ini, "GA_BAKED_RESOURCE_ITEM_TYPES", "ResourceItemTypes");
+        }
+
+        private void AddBakedString(ConfigHierarchy Ini, string Definition, string Key, string DefaultValue)
+        {
+            string Value;
+            if (!Ini.GetString(SettingsSection, Key, out Value))
+            {
+                Value = DefaultValue;
+            }
+            PrivateDefinitions.Add(string.Format("{0}=\"{1}\"", Definition, EscapeDefinitionString(Value)));
+        }
+
+        private void AddBakedBool(ConfigHierarchy Ini, string Definition, string Key, bool DefaultValue)
+        {
+            bool Value;
+            if (!Ini.GetBool(SettingsSection, Key, out Value))
+            {
+                Value = DefaultValue;
+            }
+            PrivateDefinitions.Add(string.Format("{0}={1}", Definition, Value ? 1 : 0));
+        }
+
+        // Lists become a comma separated sequence of string literals, so values may contain any character
+        private void AddBakedList(ConfigHierarchy Ini, string Definition, string Key)
+        {
+            List<string> Values;
+            if (!Ini.GetArray(SettingsSection, Key, out Values))
+            {
+                Values = new List<string>();
+            }
+            PrivateDefinitions.Add(string.Format("{0}={1}", Definition, string.Join(",", Values.ConvertAll(Value => "TEXT(\"" + EscapeDefinitionString(Value) + "\")"))));
+        }
+
+        private static string EscapeDefinitionString(string Value)
+        {
+            return Value.Replace("\\", "\\\\").Replace("\"", "\\\"");
+        }
+#endif
     }
 }
@@ -1,6 +1,8 @@
 #include "../GA-SDK-ANDROID/GameAnalyticsJNI.h"
 #include "Android/AndroidJNI.h"
 #include "Android/AndroidApplication.h"
+#include "GameAnalyticsStringSink.h"
+#include "GameAnalyticsJNIHelpers.h"
 
 #define GAMEANALYTICS_CLASS_NAME "com/gameanalytics/sdk/GameAnalytics"
 
@@ -9,48 +11,83 @@
 #endif
 #define LOG_TAG "GameAnalytics"
 
+namespace
+{
+    /** The GameAnalytics Java class, looked up once and kept alive as a global reference */
+    jclass GetGameAnalyticsClass(JNIEnv* env)
+    {
+        static const jclass GlobalClass = [env]() -> jclass
+        {
+            jclass localClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            if (!localClass)
+            {
+                return nullptr;
+            }
+            jclass globalClass = (jclass)env->NewGlobalRef(localClass);
+            env->DeleteLocalRef(localClass);
+            return globalClass;
+        }();
+        return GlobalClass;
+    }
+
+    /** Method lookup meant to be stored in a function local static, the ID stays valid since the class is never unloaded */
+    jmethodID GetStaticMethod(JNIEnv* env, jclass jClass, const char* name, const char* signature)
+    {
+        jmethodID jMethod = env->GetStaticMethodID(jClass, name, signature);
+        if (!jMethod)
+        {
+            // clear the pending NoSuchMethodError, the caller logs the failure
+            env->ExceptionClear();
+        }
+        return jMethod;
+    }
+
+    FGAJniStringCache GStringCache;
+
+    /** Hands the UTF-16 characters of a Java string to the sink, without going through modified UTF-8 and a std::string */
+    void WriteJavaString(JNIEnv* env, jstring j_s, FGAStringSink& out)
+    {
+        if (!j_s)
+        {
+            out.SetUtf16(nullptr, 0);
+            return;
+        }
+
+        const jsize length = env->GetStringLength(j_s);
+        const jchar* chars = env->GetStringChars(j_s, nullptr);
+        if (!chars)
+        {
+            env->ExceptionClear();
+            out.SetUtf16(nullptr, 0);
+            return;
+        }
+
+        out.SetUtf16(reinterpret_cast<const UTF16CHAR*>(chars), length);
+        env->ReleaseStringChars(j_s, chars);
+    }
+}
+
 namespace gameanalytics {
     extern "C"
     {
         void jni_configureAvailableCustomDimensions01(const std::vector<std::string>& list)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "configureAvailableCustomDimensions01";
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "([Ljava/lang/String;)V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "([Ljava/lang/String;)V");
 
                 if(jMethod)
                 {
-                    jstring str;
-                    jobjectArray j_array = 0;
-                    jsize len = list.size();
-                    j_array = env->NewObjectArray(len, env->FindClass("java/lang/String"), 0);
-
-                    int i = 0;
-                    for (std::string s : list)
-                    {
-                        str = env->NewStringUTF(s.c_str());
-                        env->SetObjectArrayElement(j_array, i, str);
-                        ++i;
-                    }
-
-                    env->CallStaticVoidMethod(jClass, jMethod, j_array);
-                    for (i = 0; i < list.size(); ++i)
-                    {
-                        jobject localRef = env->GetObjectArrayElement(j_array, i);
-                        env->DeleteLocalRef(localRef);
-                    }
-                    env->DeleteLocalRef(j_array);
+                    FGAJniCalls::CallStaticVoidMethodWithStringArray(env, jClass, jMethod, list);
                 }
                 else
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -61,42 +98,21 @@ namespace gameanalytics {
         void jni_configureAvailableCustomDimensions02(const std::vector<std::string>& list)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "configureAvailableCustomDimensions02";
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "([Ljava/lang/String;)V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "([Ljava/lang/String;)V");
 
                 if(jMethod)
                 {
-                    jstring str;
-                    jobjectArray j_array = 0;
-                    jsize len = list.size();
-                    j_array = env->NewObjectArray(len, env->FindClass("java/lang/String"), 0);
-
-                    int i = 0;
-                    for (std::string s : list)
-                    {
-                        str = env->NewStringUTF(s.c_str());
-                        env->SetObjectArrayElement(j_array, i, str);
-                        ++i;
-                    }
-
-                    env->CallStaticVoidMethod(jClass, jMethod, j_array);
-                    for (i = 0; i < list.size(); ++i)
-                    {
-                        jobject localRef = env->GetObjectArrayElement(j_array, i);
-                        env->DeleteLocalRef(localRef);
-                    }
-                    env->DeleteLocalRef(j_array);
+                    FGAJniCalls::CallStaticVoidMethodWithStringArray(env, jClass, jMethod, list);
                 }
                 else
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -107,42 +123,21 @@ namespace gameanalytics {
         void jni_configureAvailableCustomDimensions03(const std::vector<std::string>& list)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "configureAvailableCustomDimensions03";
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "([Ljava/lang/String;)V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "([Ljava/lang/String;)V");
 
                 if(jMethod)
                 {
-                    jstring str;
-                    jobjectArray j_array = 0;
-                    jsize len = list.size();
-                    j_array = env->NewObjectArray(len, env->FindClass("java/lang/String"), 0);
-
-                    int i = 0;
-                    for (std::string s : list)
-                    {
-                        str = env->NewStringUTF(s.c_str());
-                        env->SetObjectArrayElement(j_array, i, str);
-                        ++i;
-                    }
-
-                    env->CallStaticVoidMethod(jClass, jMethod, j_array);
-                    for (i = 0; i < list.size(); ++i)
-                    {
-                        jobject localRef = env->GetObjectArrayElement(j_array, i);
-                        env->DeleteLocalRef(localRef);
-                    }
-                    env->DeleteLocalRef(j_array);
+                    FGAJniCalls::CallStaticVoidMethodWithStringArray(env, jClass, jMethod, list);
                 }
                 else
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -153,42 +148,21 @@ namespace gameanalytics {
         void jni_configureAvailableResourceCurrencies(const std::vector<std::string>& list)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "configureAvailableResourceCurrencies";
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "([Ljava/lang/String;)V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "([Ljava/lang/String;)V");
 
                 if(jMethod)
                 {
-                    jstring str;
-                    jobjectArray j_array = 0;
-                    jsize len = list.size();
-                    j_array = env->NewObjectArray(len, env->FindClass("java/lang/String"), 0);
-
-                    int i = 0;
-                    for (std::string s : list)
-                    {
-                        str = env->NewStringUTF(s.c_str());
-                        env->SetObjectArrayElement(j_array, i, str);
-                        ++i;
-                    }
-
-                    env->CallStaticVoidMethod(jClass, jMethod, j_array);
-                    for (i = 0; i < list.size(); ++i)
-                    {
-                        jobject localRef = env->GetObjectArrayElement(j_array, i);
-                        env->DeleteLocalRef(localRef);
-                    }
-                    env->DeleteLocalRef(j_array);
+                    FGAJniCalls::CallStaticVoidMethodWithStringArray(env, jClass, jMethod, list);
                 }
                 else
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -199,42 +173,21 @@ namespace gameanalytics {
         void jni_configureAvailableResourceItemTypes(const std::vector<std::string>& list)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "configureAvailableResourceItemTypes";
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "([Ljava/lang/String;)V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "([Ljava/lang/String;)V");
 
                 if(jMethod)
                 {
-                    jstring str;
-                    jobjectArray j_array = 0;
-                    jsize len = list.size();
-                    j_array = env->NewObjectArray(len, env->FindClass("java/lang/String"), 0);
-
-                    int i = 0;
-                    for (std::string s : list)
-                    {
-                        str = env->NewStringUTF(s.c_str());
-                        env->SetObjectArrayElement(j_array, i, str);
-                        ++i;
-                    }
-
-                    env->CallStaticVoidMethod(jClass, jMethod, j_array);
-                    for (i = 0; i < list.size(); ++i)
-                    {
-                        jobject localRef = env->GetObjectArrayElement(j_array, i);
-                        env->DeleteLocalRef(localRef);
-                    }
-                    env->DeleteLocalRef(j_array);
+                    FGAJniCalls::CallStaticVoidMethodWithStringArray(env, jClass, jMethod, list);
                 }
                 else
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -245,25 +198,23 @@ namespace gameanalytics {
         void jni_configureBuild(const char *build)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "configureBuild";
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "(Ljava/lang/String;)V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "(Ljava/lang/String;)V");
 
                 if(jMethod)
                 {
+                    FGAJniLocalFrame frame(env);
                     jstring j_string = env->NewStringUTF(build);
                     env->CallStaticVoidMethod(jClass, jMethod, j_string);
-                    env->DeleteLocalRef(j_string);
                 }
                 else
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -274,12 +225,12 @@ namespace gameanalytics {
         void jni_configureAutoDetectAppVersion(bool flag)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "configureAutoDetectAppVersion";
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "(Z)V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "(Z)V");
 
                 if(jMethod)
                 {
@@ -289,8 +240,6 @@ namespace gameanalytics {
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -301,25 +250,23 @@ namespace gameanalytics {
         void jni_configureUserId(const char *userId)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "configureUserId";
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "(Ljava/lang/String;)V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "(Ljava/lang/String;)V");
 
                 if(jMethod)
                 {
+                    FGAJniLocalFrame frame(env);
                     jstring j_string = env->NewStringUTF(userId);
                     env->CallStaticVoidMethod(jClass, jMethod, j_string);
-                    env->DeleteLocalRef(j_string);
                 }
                 else
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -330,25 +277,23 @@ namespace gameanalytics {
         void jni_configureSdkGameEngineVersion(const char *gameEngineSdkVersion)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "configureSdkGameEngineVersion";
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "(Ljava/lang/String;)V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "(Ljava/lang/String;)V");
 
                 if(jMethod)
                 {
+                    FGAJniLocalFrame frame(env);
                     jstring j_string = env->NewStringUTF(gameEngineSdkVersion);
                     env->CallStaticVoidMethod(jClass, jMethod, j_string);
-                    env->DeleteLocalRef(j_string);
                 }
                 else
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -359,25 +304,23 @@ namespace gameanalytics {
         void jni_configureGameEngineVersion(const char *gameEngineSdkVersion)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "configureGameEngineVersion";
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "(Ljava/lang/String;)V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "(Ljava/lang/String;)V");
 
                 if(jMethod)
                 {
+                    FGAJniLocalFrame frame(env);
                     jstring j_string = env->NewStringUTF(gameEngineSdkVersion);
                     env->CallStaticVoidMethod(jClass, jMethod, j_string);
-                    env->DeleteLocalRef(j_string);
                 }
                 else
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -385,31 +328,48 @@ namespace gameanalytics {
             }
         }
 
+        // configuration is the JSON object written by UGameAnalytics::configure, unpacked by the GameActivity thunk from GameAnalytics_APL.xml
+        void jni_configure(const char *configuration)
+        {
+            JNIEnv* env = FAndroidApplication::GetJavaEnv();
+            const char* strMethod = "AndroidThunkJava_GameAnalyticsConfigure";
+
+            static const jmethodID jMethod = GetStaticMethod(env, FJavaWrapper::GameActivityClassID, strMethod, "(Ljava/lang/String;)V");
+
+            if(jMethod)
+            {
+                FGAJniLocalFrame frame(env);
+                jstring j_configuration = env->NewStringUTF(configuration);
+                env->CallStaticVoidMethod(FJavaWrapper::GameActivityClassID, jMethod, j_configuration);
+            }
+            else
+            {
+                __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
+            }
+        }
+
         void jni_initialize(const char *gameKey, const char *gameSecret)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "initialize";
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "(Landroid/app/Activity;Ljava/lang/String;Ljava/lang/String;)V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "(Landroid/app/Activity;Ljava/lang/String;Ljava/lang/String;)V");
 
                 if(jMethod)
                 {
+                    FGAJniLocalFrame frame(env);
                     jobject activity = FAndroidApplication::GetGameActivityThis();
                     jstring j_gameKey = env->NewStringUTF(gameKey);
                     jstring j_gameSecret = env->NewStringUTF(gameSecret);
                     env->CallStaticVoidMethod(jClass, jMethod, activity, j_gameKey, j_gameSecret);
-                    env->DeleteLocalRef(j_gameKey);
-                    env->DeleteLocalRef(j_gameSecret);
                 }
                 else
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -420,33 +380,27 @@ namespace gameanalytics {
         void jni_addBusinessEvent(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType, const char *fields, bool mergeFields)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "addBusinessEvent";
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "(Ljava/lang/String;ILjava/lang/String;Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;Z)V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "(Ljava/lang/String;ILjava/lang/String;Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;Z)V");
 
                 if(jMethod)
                 {
-                    jstring j_currency = env->NewStringUTF(currency);
-                    jstring j_itemType = env->NewStringUTF(itemType);
-                    jstring j_itemId = env->NewStringUTF(itemId);
-                    jstring j_cartType = env->NewStringUTF(cartType);
+                    FGAJniLocalFrame frame(env);
+                    jstring j_currency = GStringCache.Get(env, currency);
+                    jstring j_itemType = GStringCache.Get(env, itemType);
+                    jstring j_itemId = GStringCache.Get(env, itemId);
+                    jstring j_cartType = GStringCache.Get(env, cartType);
                     jstring j_fields = env->NewStringUTF(fields);
                     env->CallStaticVoidMethod(jClass, jMethod, j_currency, amount, j_itemType, j_itemId, j_cartType, j_fields, mergeFields);
-                    env->DeleteLocalRef(j_currency);
-                    env->DeleteLocalRef(j_itemType);
-                    env->DeleteLocalRef(j_itemId);
-                    env->DeleteLocalRef(j_cartType);
-                    env->DeleteLocalRef(j_fields);
                 }
                 else
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -458,39 +412,30 @@ namespace gameanalytics {
                                              const char *receipt, const char *store, const char *signature, const char *fields, bool mergeFields)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "addBusinessEvent";
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "(Ljava/lang/String;ILjava/lang/String;Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;Z)V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "(Ljava/lang/String;ILjava/lang/String;Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;Z)V");
 
                 if(jMethod)
                 {
-                    jstring j_currency = env->NewStringUTF(currency);
-                    jstring j_itemType = env->NewStringUTF(itemType);
-                    jstring j_itemId = env->NewStringUTF(itemId);
-                    jstring j_cartType = env->NewStringUTF(cartType);
+                    FGAJniLocalFrame frame(env);
+                    jstring j_currency = GStringCache.Get(env, currency);
+                    jstring j_itemType = GStringCache.Get(env, itemType);
+                    jstring j_itemId = GStringCache.Get(env, itemId);
+                    jstring j_cartType = GStringCache.Get(env, cartType);
                     jstring j_receipt = env->NewStringUTF(receipt);
-                    jstring j_store = env->NewStringUTF(store);
+                    jstring j_store = GStringCache.Get(env, store);
                     jstring j_signature = env->NewStringUTF(signature);
                     jstring j_fields = env->NewStringUTF(fields);
                     env->CallStaticVoidMethod(jClass, jMethod, j_currency, amount, j_itemType, j_itemId, j_cartType, j_receipt, j_store, j_signature, j_fields, mergeFields);
-                    env->DeleteLocalRef(j_currency);
-                    env->DeleteLocalRef(j_itemType);
-                    env->DeleteLocalRef(j_itemId);
-                    env->DeleteLocalRef(j_cartType);
-                    env->DeleteLocalRef(j_receipt);
-                    env->DeleteLocalRef(j_store);
-                    env->DeleteLocalRef(j_signature);
-                    env->DeleteLocalRef(j_fields);
                 }
                 else
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -501,31 +446,26 @@ namespace gameanalytics {
         void jni_addResourceEvent(int flowType, const char *currency, float amount, const char *itemType, const char *itemId, const char *fields, bool mergeFields)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "addResourceEvent";
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "(ILjava/lang/String;FLjava/lang/String;Ljava/lang/String;Ljava/lang/String;Z)V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "(ILjava/lang/String;FLjava/lang/String;Ljava/lang/String;Ljava/lang/String;Z)V");
 
                 if(jMethod)
                 {
-                    jstring j_currency = env->NewStringUTF(currency);
-                    jstring j_itemType = env->NewStringUTF(itemType);
-                    jstring j_itemId = env->NewStringUTF(itemId);
+                    FGAJniLocalFrame frame(env);
+                    jstring j_currency = GStringCache.Get(env, currency);
+                    jstring j_itemType = GStringCache.Get(env, itemType);
+                    jstring j_itemId = GStringCache.Get(env, itemId);
                     jstring j_fields = env->NewStringUTF(fields);
                     env->CallStaticVoidMethod(jClass, jMethod, flowType, j_currency, amount, j_itemType, j_itemId, j_fields, mergeFields);
-                    env->DeleteLocalRef(j_currency);
-                    env->DeleteLocalRef(j_itemType);
-                    env->DeleteLocalRef(j_itemId);
-                    env->DeleteLocalRef(j_fields);
                 }
                 else
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -536,31 +476,26 @@ namespace gameanalytics {
         void jni_addProgressionEvent(int progressionStatus, const char *progression01, const char *progression02, const char *progression03, const char *fields, bool mergeFields)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "addProgressionEvent";
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "(ILjava/lang/String;Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;Z)V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "(ILjava/lang/String;Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;Z)V");
 
                 if(jMethod)
                 {
-                    jstring j_progression01 = env->NewStringUTF(progression01);
-                    jstring j_progression02 = env->NewStringUTF(progression02);
-                    jstring j_progression03 = env->NewStringUTF(progression03);
+                    FGAJniLocalFrame frame(env);
+                    jstring j_progression01 = GStringCache.Get(env, progression01);
+                    jstring j_progression02 = GStringCache.Get(env, progression02);
+                    jstring j_progression03 = GStringCache.Get(env, progression03);
                     jstring j_fields = env->NewStringUTF(fields);
                     env->CallStaticVoidMethod(jClass, jMethod, progressionStatus, j_progression01, j_progression02, j_progression03, j_fields, mergeFields);
-                    env->DeleteLocalRef(j_progression01);
-                    env->DeleteLocalRef(j_progression02);
-                    env->DeleteLocalRef(j_progression03);
-                    env->DeleteLocalRef(j_fields);
                 }
                 else
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -571,31 +506,26 @@ namespace gameanalytics {
         void jni_addProgressionEventWithScore(int progressionStatus, const char *progression01, const char *progression02, const char *progression03, int score, const char *fields, bool mergeFields)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "addProgressionEvent";
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "(ILjava/lang/String;Ljava/lang/String;Ljava/lang/String;DLjava/lang/String;Z)V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "(ILjava/lang/String;Ljava/lang/String;Ljava/lang/String;DLjava/lang/String;Z)V");
 
                 if(jMethod)
                 {
-                    jstring j_progression01 = env->NewStringUTF(progression01);
-                    jstring j_progression02 = env->NewStringUTF(progression02);
-                    jstring j_progression03 = env->NewStringUTF(progression03);
+                    FGAJniLocalFrame frame(env);
+                    jstring j_progression01 = GStringCache.Get(env, progression01);
+                    jstring j_progression02 = GStringCache.Get(env, progression02);
+                    jstring j_progression03 = GStringCache.Get(env, progression03);
                     jstring j_fields = env->NewStringUTF(fields);
                     env->CallStaticVoidMethod(jClass, jMethod, progressionStatus, j_progression01, j_progression02, j_progression03, (double)score, j_fields, mergeFields);
-                    env->DeleteLocalRef(j_progression01);
-                    env->DeleteLocalRef(j_progression02);
-                    env->DeleteLocalRef(j_progression03);
-                    env->DeleteLocalRef(j_fields);
                 }
                 else
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -606,27 +536,21 @@ namespace gameanalytics {
         void jni_addDesignEvent(const char *eventId, const char *fields, bool mergeFields)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "addDesignEvent";
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "(Ljava/lang/String;Ljava/lang/String;Z)V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "(Ljava/lang/String;Ljava/lang/String;Z)V");
 
                 if(jMethod)
                 {
-                    jstring j_eventId = env->NewStringUTF(eventId);
-                    jstring j_fields = env->NewStringUTF(fields);
-                    env->CallStaticVoidMethod(jClass, jMethod, j_eventId, j_fields, mergeFields);
-                    env->DeleteLocalRef(j_eventId);
-                    env->DeleteLocalRef(j_fields);
+                    FGAJniCalls::CallStaticVoidMethodWithCachedString(env, GStringCache, jClass, jMethod, eventId, fields, mergeFields);
                 }
                 else
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -637,27 +561,24 @@ namespace gameanalytics {
         void jni_addDesignEventWithValue(const char *eventId, float value, const char *fields, bool mergeFields)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "addDesignEvent";
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "(Ljava/lang/String;DLjava/lang/String;Z)V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "(Ljava/lang/String;DLjava/lang/String;Z)V");
 
                 if(jMethod)
                 {
-                    jstring j_eventId = env->NewStringUTF(eventId);
+                    FGAJniLocalFrame frame(env);
+                    jstring j_eventId = GStringCache.Get(env, eventId);
                     jstring j_fields = env->NewStringUTF(fields);
                     env->CallStaticVoidMethod(jClass, jMethod, j_eventId, value, j_fields, mergeFields);
-                    env->DeleteLocalRef(j_eventId);
-                    env->DeleteLocalRef(j_fields);
                 }
                 else
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -668,27 +589,24 @@ namespace gameanalytics {
         void jni_addErrorEvent(int severity, const char *message, const char *fields, bool mergeFields)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "addErrorEvent";
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "(ILjava/lang/String;Ljava/lang/String;Z)V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "(ILjava/lang/String;Ljava/lang/String;Z)V");
 
                 if(jMethod)
                 {
+                    FGAJniLocalFrame frame(env);
                     jstring j_message = env->NewStringUTF(message);
                     jstring j_fields = env->NewStringUTF(fields);
                     env->CallStaticVoidMethod(jClass, jMethod, severity, j_message, j_fields, mergeFields);
-                    env->DeleteLocalRef(j_message);
-                    env->DeleteLocalRef(j_fields);
                 }
                 else
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -699,29 +617,25 @@ namespace gameanalytics {
         void jni_addAdEvent(int action, int adType, const char *adSdkName, const char *adPlacement, const char *fields, bool mergeFields)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "addAdEvent";
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "(IILjava/lang/String;Ljava/lang/String;Ljava/lang/String;Z)V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "(IILjava/lang/String;Ljava/lang/String;Ljava/lang/String;Z)V");
 
                 if(jMethod)
                 {
-                    jstring j_adSdkName = env->NewStringUTF(adSdkName);
-                    jstring j_adPlacement = env->NewStringUTF(adPlacement);
+                    FGAJniLocalFrame frame(env);
+                    jstring j_adSdkName = GStringCache.Get(env, adSdkName);
+                    jstring j_adPlacement = GStringCache.Get(env, adPlacement);
                     jstring j_fields = env->NewStringUTF(fields);
                     env->CallStaticVoidMethod(jClass, jMethod, action, adType, j_adSdkName, j_adPlacement, j_fields, mergeFields);
-                    env->DeleteLocalRef(j_adSdkName);
-                    env->DeleteLocalRef(j_adPlacement);
-                    env->DeleteLocalRef(j_fields);
                 }
                 else
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -732,29 +646,25 @@ namespace gameanalytics {
         void jni_addAdEventWithDuration(int action, int adType, const char *adSdkName, const char *adPlacement, int64_t duration, const char *fields, bool mergeFields)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "addAdEvent";
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "(IILjava/lang/String;Ljava/lang/String;JLjava/lang/String;Z)V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "(IILjava/lang/String;Ljava/lang/String;JLjava/lang/String;Z)V");
 
                 if(jMethod)
                 {
-                    jstring j_adSdkName = env->NewStringUTF(adSdkName);
-                    jstring j_adPlacement = env->NewStringUTF(adPlacement);
+                    FGAJniLocalFrame frame(env);
+                    jstring j_adSdkName = GStringCache.Get(env, adSdkName);
+                    jstring j_adPlacement = GStringCache.Get(env, adPlacement);
                     jstring j_fields = env->NewStringUTF(fields);
                     env->CallStaticVoidMethod(jClass, jMethod, action, adType, j_adSdkName, j_adPlacement, duration, j_fields, mergeFields);
-                    env->DeleteLocalRef(j_adSdkName);
-                    env->DeleteLocalRef(j_adPlacement);
-                    env->DeleteLocalRef(j_fields);
                 }
                 else
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -765,29 +675,25 @@ namespace gameanalytics {
         void jni_addAdEventWithNoAdReason(int action, int adType, const char *adSdkName, const char *adPlacement, int noAdReason, const char *fields, bool mergeFields)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "addAdEvent";
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "(IILjava/lang/String;Ljava/lang/String;ILjava/lang/String;Z)V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "(IILjava/lang/String;Ljava/lang/String;ILjava/lang/String;Z)V");
 
                 if(jMethod)
                 {
-                    jstring j_adSdkName = env->NewStringUTF(adSdkName);
-                    jstring j_adPlacement = env->NewStringUTF(adPlacement);
+                    FGAJniLocalFrame frame(env);
+                    jstring j_adSdkName = GStringCache.Get(env, adSdkName);
+                    jstring j_adPlacement = GStringCache.Get(env, adPlacement);
                     jstring j_fields = env->NewStringUTF(fields);
                     env->CallStaticVoidMethod(jClass, jMethod, action, adType, j_adSdkName, j_adPlacement, noAdReason, j_fields, mergeFields);
-                    env->DeleteLocalRef(j_adSdkName);
-                    env->DeleteLocalRef(j_adPlacement);
-                    env->DeleteLocalRef(j_fields);
                 }
                 else
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -798,12 +704,12 @@ namespace gameanalytics {
         void jni_setEnabledInfoLog(bool flag)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "setEnabledInfoLog";
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "(Z)V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "(Z)V");
 
                 if(jMethod)
                 {
@@ -813,8 +719,6 @@ namespace gameanalytics {
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -825,12 +729,12 @@ namespace gameanalytics {
         void jni_setEnabledVerboseLog(bool flag)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "setEnabledVerboseLog";
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "(Z)V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "(Z)V");
 
                 if(jMethod)
                 {
@@ -840,8 +744,6 @@ namespace gameanalytics {
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -852,12 +754,12 @@ namespace gameanalytics {
         void jni_setEnabledManualSessionHandling(bool flag)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "setEnabledManualSessionHandling";
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "(Z)V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "(Z)V");
 
                 if(jMethod)
                 {
@@ -867,8 +769,6 @@ namespace gameanalytics {
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -879,12 +779,12 @@ namespace gameanalytics {
         void jni_setEnabledErrorReporting(bool flag)
         {
             JNIEnv *env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char *strMethod = "setEnabledErrorReporting";
 
             if (jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "(Z)V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "(Z)V");
 
                 if (jMethod)
                 {
@@ -894,8 +794,6 @@ namespace gameanalytics {
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -906,12 +804,12 @@ namespace gameanalytics {
         void jni_setEnabledEventSubmission(bool flag)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "setEnabledEventSubmission";
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "(Z)V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "(Z)V");
 
                 if(jMethod)
                 {
@@ -921,8 +819,6 @@ namespace gameanalytics {
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -933,25 +829,23 @@ namespace gameanalytics {
         void jni_setCustomDimension01(const char *customDimension)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "setCustomDimension01";
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "(Ljava/lang/String;)V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "(Ljava/lang/String;)V");
 
                 if(jMethod)
                 {
-                    jstring j_customDimension = env->NewStringUTF(customDimension);
+                    FGAJniLocalFrame frame(env);
+                    jstring j_customDimension = GStringCache.Get(env, customDimension);
                     env->CallStaticVoidMethod(jClass, jMethod, j_customDimension);
-                    env->DeleteLocalRef(j_customDimension);
                 }
                 else
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -962,25 +856,23 @@ namespace gameanalytics {
         void jni_setCustomDimension02(const char *customDimension)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "setCustomDimension02";
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "(Ljava/lang/String;)V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "(Ljava/lang/String;)V");
 
                 if(jMethod)
                 {
-                    jstring j_customDimension = env->NewStringUTF(customDimension);
+                    FGAJniLocalFrame frame(env);
+                    jstring j_customDimension = GStringCache.Get(env, customDimension);
                     env->CallStaticVoidMethod(jClass, jMethod, j_customDimension);
-                    env->DeleteLocalRef(j_customDimension);
                 }
                 else
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -991,25 +883,23 @@ namespace gameanalytics {
         void jni_setCustomDimension03(const char *customDimension)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "setCustomDimension03";
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "(Ljava/lang/String;)V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "(Ljava/lang/String;)V");
 
                 if(jMethod)
                 {
-                    jstring j_customDimension = env->NewStringUTF(customDimension);
+                    FGAJniLocalFrame frame(env);
+                    jstring j_customDimension = GStringCache.Get(env, customDimension);
                     env->CallStaticVoidMethod(jClass, jMethod, j_customDimension);
-                    env->DeleteLocalRef(j_customDimension);
                 }
                 else
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -1020,12 +910,12 @@ namespace gameanalytics {
         void jni_startSession()
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "startSession";
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "()V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "()V");
 
                 if(jMethod)
                 {
@@ -1035,8 +925,6 @@ namespace gameanalytics {
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -1047,12 +935,12 @@ namespace gameanalytics {
         void jni_endSession()
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "endSession";
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "()V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "()V");
 
                 if(jMethod)
                 {
@@ -1062,8 +950,6 @@ namespace gameanalytics {
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -1071,92 +957,73 @@ namespace gameanalytics {
             }
         }
 
-        void jni_getRemoteConfigsValueAsString(const char *key, char** out)
+        void jni_getRemoteConfigsValueAsString(const char *key, FGAStringSink& out)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "getRemoteConfigsValueAsString";
-            std::string result;
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "(Ljava/lang/String;)Ljava/lang/String;");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "(Ljava/lang/String;)Ljava/lang/String;");
 
                 if(jMethod)
                 {
-                    jstring j_key = env->NewStringUTF(key);
+                    FGAJniLocalFrame frame(env);
+                    jstring j_key = GStringCache.Get(env, key);
                     jstring j_s = (jstring)env->CallStaticObjectMethod(jClass, jMethod, j_key);
-                    const char* s = env->GetStringUTFChars(j_s, 0);
-                    result = s;
-                    env->ReleaseStringUTFChars(j_s, s);
-                    env->DeleteLocalRef(j_key);
+                    WriteJavaString(env, j_s, out);
                 }
                 else
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
                 __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find class %s ***", GAMEANALYTICS_CLASS_NAME);
             }
-
-            char* tmp = new char[result.size() + 1];
-            snprintf(tmp, result.size() + 1, "%s", result.c_str());
-            *out = tmp;
         }
 
-        void jni_getRemoteConfigsValueAsStringWithDefaultValue(const char *key, const char *defaultValue, char** out)
+        void jni_getRemoteConfigsValueAsStringWithDefaultValue(const char *key, const char *defaultValue, FGAStringSink& out)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "getRemoteConfigsValueAsString";
-            std::string result;
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "(Ljava/lang/String;Ljava/lang/String;)Ljava/lang/String;");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "(Ljava/lang/String;Ljava/lang/String;)Ljava/lang/String;");
 
                 if(jMethod)
                 {
-                    jstring j_key = env->NewStringUTF(key);
+                    FGAJniLocalFrame frame(env);
+                    jstring j_key = GStringCache.Get(env, key);
                     jstring j_defaultValue = env->NewStringUTF(defaultValue);
                     jstring j_s = (jstring)env->CallStaticObjectMethod(jClass, jMethod, j_key, j_defaultValue);
-                    const char* s = env->GetStringUTFChars(j_s, 0);
-                    result = s;
-                    env->ReleaseStringUTFChars(j_s, s);
-                    env->DeleteLocalRef(j_key);
-                    env->DeleteLocalRef(j_defaultValue);
+                    WriteJavaString(env, j_s, out);
                 }
                 else
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
                 __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find class %s ***", GAMEANALYTICS_CLASS_NAME);
             }
-
-            char* tmp = new char[result.size() + 1];
-            snprintf(tmp, result.size() + 1, "%s", result.c_str());
-            *out = tmp;
         }
 
         bool jni_isRemoteConfigsReady()
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "isRemoteConfigsReady";
             bool result = false;
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "()Z");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "()Z");
 
                 if(jMethod)
                 {
@@ -1166,8 +1033,6 @@ namespace gameanalytics {
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -1177,120 +1042,96 @@ namespace gameanalytics {
             return result;
         }
 
-        void jni_getRemoteConfigsContentAsString(char** out)
+        void jni_getRemoteConfigsContentAsString(FGAStringSink& out)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "getRemoteConfigsContentAsString";
-            std::string result;
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "()Ljava/lang/String;");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "()Ljava/lang/String;");
 
                 if(jMethod)
                 {
+                    FGAJniLocalFrame frame(env);
                     jstring j_s = (jstring)env->CallStaticObjectMethod(jClass, jMethod);
-                    const char* s = env->GetStringUTFChars(j_s, 0);
-                    result = s;
-                    env->ReleaseStringUTFChars(j_s, s);
+                    WriteJavaString(env, j_s, out);
                 }
                 else
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
                 __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find class %s ***", GAMEANALYTICS_CLASS_NAME);
             }
-
-            char* tmp = new char[result.size() + 1];
-            snprintf(tmp, result.size() + 1, "%s", result.c_str());
-            *out = tmp;
         }
 
-        void jni_getABTestingId(char** out)
+        void jni_getABTestingId(FGAStringSink& out)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "getABTestingId";
-            std::string result;
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "()Ljava/lang/String;");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "()Ljava/lang/String;");
 
                 if(jMethod)
                 {
+                    FGAJniLocalFrame frame(env);
                     jstring j_s = (jstring)env->CallStaticObjectMethod(jClass, jMethod);
-                    const char* s = env->GetStringUTFChars(j_s, 0);
-                    result = s;
-                    env->ReleaseStringUTFChars(j_s, s);
+                    WriteJavaString(env, j_s, out);
                 }
                 else
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
                 __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find class %s ***", GAMEANALYTICS_CLASS_NAME);
             }
-
-            char* tmp = new char[result.size() + 1];
-            snprintf(tmp, result.size() + 1, "%s", result.c_str());
-            *out = tmp;
         }
 
-        void jni_getABTestingVariantId(char** out)
+        void jni_getABTestingVariantId(FGAStringSink& out)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             const char* strMethod = "getABTestingVariantId";
-            std::string result;
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "()Ljava/lang/String;");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "()Ljava/lang/String;");
 
                 if(jMethod)
                 {
+                    FGAJniLocalFrame frame(env);
                     jstring j_s = (jstring)env->CallStaticObjectMethod(jClass, jMethod);
-                    const char* s = env->GetStringUTFChars(j_s, 0);
-                    result = s;
-                    env->ReleaseStringUTFChars(j_s, s);
+                    WriteJavaString(env, j_s, out);
                 }
                 else
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
                 __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find class %s ***", GAMEANALYTICS_CLASS_NAME);
             }
-
-            char* tmp = new char[result.size() + 1];
-            snprintf(tmp, result.size() + 1, "%s", result.c_str());
-            *out = tmp;
         }
 
         void jni_enableSDKInitEvent(bool value)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             constexpr const char* strMethod = "enableSDKInitEvent";
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "(Z)V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "(Z)V");
 
                 if(jMethod)
                 {
@@ -1300,8 +1141,6 @@ namespace gameanalytics {
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -1312,12 +1151,12 @@ namespace gameanalytics {
         void jni_enableFpsHistogram(bool value)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             constexpr const char* strMethod = "enableFpsHistogram";
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "(Z)V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "(Z)V");
 
                 if(jMethod)
                 {
@@ -1327,8 +1166,6 @@ namespace gameanalytics {
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -1339,12 +1176,12 @@ namespace gameanalytics {
         void jni_enableMemoryHistogram(bool value)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             constexpr const char* strMethod = "enableMemoryHistogram";
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "(Z)V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "(Z)V");
 
                 if(jMethod)
                 {
@@ -1354,8 +1191,6 @@ namespace gameanalytics {
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -1366,12 +1201,12 @@ namespace gameanalytics {
         void jni_enableHealthHardwareInfo(bool value)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             constexpr const char* strMethod = "enableHealthHardwareInfo";
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "(Z)V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "(Z)V");
 
                 if(jMethod)
                 {
@@ -1381,8 +1216,6 @@ namespace gameanalytics {
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
@@ -1393,12 +1226,12 @@ namespace gameanalytics {
         void jni_setGAIDTracking(bool value)
         {
             JNIEnv* env = FAndroidApplication::GetJavaEnv();
-            jclass jClass = FAndroidApplication::FindJavaClass(GAMEANALYTICS_CLASS_NAME);
+            jclass jClass = GetGameAnalyticsClass(env);
             constexpr const char* strMethod = "setGAIDTracking";
 
             if(jClass)
             {
-                jmethodID jMethod = env->GetStaticMethodID(jClass, strMethod, "(Z)V");
+                static const jmethodID jMethod = GetStaticMethod(env, jClass, strMethod, "(Z)V");
 
                 if(jMethod)
                 {
@@ -1408,8 +1241,6 @@ namespace gameanalytics {
                 {
                     __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "*** Failed to find method %s ***", strMethod);
                 }
-
-                env->DeleteLocalRef(jClass);
             }
             else
             {
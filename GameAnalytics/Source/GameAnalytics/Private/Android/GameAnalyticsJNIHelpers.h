@@ -0,0 +1,140 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/Crc.h"
+#include "Misc/ScopeLock.h"
+#include "HAL/CriticalSection.h"
+
+#include <string>
+#include <vector>
+
+// elsewhere the includer provides the JNI types, the automation tests drive these helpers with a counting fake environment
+#if PLATFORM_ANDROID
+#include <jni.h>
+#endif
+
+/**
+ * Scoped JNI local reference frame.
+ * Every local reference created while it is alive, including the ones returned by calls into Java,
+ * is released in one go when it goes out of scope instead of piling up in the thread's local reference table.
+ */
+class FGAJniLocalFrame
+{
+public:
+    explicit FGAJniLocalFrame(JNIEnv* InEnv, jint Capacity = 16)
+        : Env(InEnv)
+        , bPushed(InEnv->PushLocalFrame(Capacity) == 0)
+    {
+    }
+
+    ~FGAJniLocalFrame()
+    {
+        if (bPushed)
+        {
+            Env->PopLocalFrame(nullptr);
+        }
+    }
+
+private:
+    JNIEnv* Env;
+    bool bPushed;
+};
+
+/**
+ * Direct-mapped cache of Java strings for the values that repeat on every event:
+ * event ids, currencies, item types, progression names, ad placements and custom dimensions.
+ * The Java strings are kept as global references, a hit costs one NewLocalRef instead of a UTF-8 decode and a Java allocation.
+ */
+class FGAJniStringCache
+{
+public:
+    /** Returns a local reference owned by the caller's frame, nullptr for a null value */
+    jstring Get(JNIEnv* env, const char* value)
+    {
+        if (value == nullptr)
+        {
+            return nullptr;
+        }
+
+        const uint32 hash = FCrc::StrCrc32(value);
+        FScopeLock Lock(&CacheLock);
+
+        FEntry& entry = Entries[hash & (CacheSize - 1)];
+        if (entry.Ref != nullptr && entry.Hash == hash && entry.Value == value)
+        {
+            // a new local reference, another thread may replace the slot while the caller still uses it
+            return (jstring)env->NewLocalRef(entry.Ref);
+        }
+
+        jstring localString = env->NewStringUTF(value);
+        if (localString == nullptr)
+        {
+            env->ExceptionClear();
+            return nullptr;
+        }
+
+        if (entry.Ref != nullptr)
+        {
+            env->DeleteGlobalRef(entry.Ref);
+        }
+        entry.Ref = (jstring)env->NewGlobalRef(localString);
+        entry.Hash = hash;
+        entry.Value = value;
+        return localString;
+    }
+
+private:
+    static constexpr uint32 CacheSize = 64;
+
+    struct FEntry
+    {
+        uint32 Hash = 0;
+        std::string Value;
+        jstring Ref = nullptr;
+    };
+
+    FEntry Entries[CacheSize];
+    FCriticalSection CacheLock;
+};
+
+/** Marshalling shared by the bridge calls, kept apart from the class and method lookups that need the Android runtime */
+struct FGAJniCalls
+{
+    /** Builds a String[] without keeping a local reference per element alive */
+    static jobjectArray NewStringArray(JNIEnv* env, const std::vector<std::string>& list)
+    {
+        static const jclass StringClass = [env]() -> jclass
+        {
+            jclass localClass = env->FindClass("java/lang/String");
+            jclass globalClass = (jclass)env->NewGlobalRef(localClass);
+            env->DeleteLocalRef(localClass);
+            return globalClass;
+        }();
+
+        jobjectArray j_array = env->NewObjectArray((jsize)list.size(), StringClass, nullptr);
+        for (jsize i = 0; i < (jsize)list.size(); ++i)
+        {
+            jstring str = env->NewStringUTF(list[i].c_str());
+            env->SetObjectArrayElement(j_array, i, str);
+            env->DeleteLocalRef(str);
+        }
+        return j_array;
+    }
+
+    /** A String[] argument, built and released inside its own frame */
+    static void CallStaticVoidMethodWithStringArray(JNIEnv* env, jclass jClass, jmethodID jMethod, const std::vector<std::string>& list)
+    {
+        FGAJniLocalFrame frame(env);
+        jobjectArray j_array = NewStringArray(env, list);
+        env->CallStaticVoidMethod(jClass, jMethod, j_array);
+    }
+
+    /** A cached string followed by the serialized custom fields and the merge flag */
+    static void CallStaticVoidMethodWithCachedString(JNIEnv* env, FGAJniStringCache& cache, jclass jClass, jmethodID jMethod, const char* value, const char* fields, bool mergeFields)
+    {
+        FGAJniLocalFrame frame(env);
+        jstring j_value = cache.Get(env, value);
+        jstring j_fields = env->NewStringUTF(fields);
+        env->CallStaticVoidMethod(jClass, jMethod, j_value, j_fields, mergeFields);
+    }
+};
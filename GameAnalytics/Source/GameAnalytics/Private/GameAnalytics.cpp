@@ -17,11 +17,28 @@
 //#include "../GA-SDK-HTML5/GameAnalytics.h"
 #endif
 
+#include "GameAnalyticsEventStaging.h"
+#include "GameAnalyticsWhitelist.h"
+#include "GameAnalyticsStats.h"
+#include "GameAnalyticsStringSink.h"
+#include "GameAnalyticsRemoteConfigs.h"
+#include "GameAnalyticsABTesting.h"
+#include "GameAnalyticsJsonWriter.h"
+#include "GameAnalyticsProgressionTracker.h"
+#include "GameAnalyticsAdDeduplication.h"
+#include "GameAnalyticsErrorRateLimiter.h"
+#include "GameAnalyticsLogBridge.h"
+#include "GameAnalyticsFrameTimeTracker.h"
 #include "Misc/EngineVersion.h"
+#include "Async/Async.h"
+#include "Misc/ScopeLock.h"
+#include "Templates/Function.h"
 #include "AnalyticsEventAttribute.h"
 #include "Serialization/JsonWriter.h"
 #include "Serialization/JsonSerializer.h"
 
+#include <atomic>
+
 #define GA_VERSION TEXT("5.6.1")
 
 std::string ToStdString(const FString& str)
@@ -49,12 +66,272 @@ void PrintList(FString const& msg, const TArray<FString>& list)
     UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("%s(%s)"), *msg, *s);
 }
 
+static FGACustomDimension GCustomDimension01(TEXT("setCustomDimension01"));
+static FGACustomDimension GCustomDimension02(TEXT("setCustomDimension02"));
+static FGACustomDimension GCustomDimension03(TEXT("setCustomDimension03"));
+static FGAStringWhitelist GResourceCurrencies;
+static FGAStringWhitelist GResourceItemTypes;
+
+DEFINE_STAT(STAT_GameAnalytics_RejectedResourceEvents);
+DEFINE_STAT(STAT_GameAnalytics_DroppedCustomFields);
+DEFINE_STAT(STAT_GameAnalytics_TruncatedCustomFieldValues);
+DEFINE_STAT(STAT_GameAnalytics_InvalidReceipts);
+DEFINE_STAT(STAT_GameAnalytics_SuppressedErrorEvents);
+
+/**
+* Custom field limits, read by every thread that raises events
+*/
+struct FGACustomFieldsBudget
+{
+    FGACustomFieldsBudget()
+    {
+        Set(FGACustomFieldsLimits());
+    }
+
+    void Set(const FGACustomFieldsLimits& limits)
+    {
+        MaxFields.store(limits.MaxFields, std::memory_order_relaxed);
+        MaxKeyLength.store(limits.MaxKeyLength, std::memory_order_relaxed);
+        MaxValueLength.store(limits.MaxValueLength, std::memory_order_relaxed);
+        MaxPayloadBytes.store(limits.MaxPayloadBytes, std::memory_order_relaxed);
+    }
+
+    std::atomic<int32> MaxFields;
+    std::atomic<int32> MaxKeyLength;
+    std::atomic<int32> MaxValueLength;
+    std::atomic<int32> MaxPayloadBytes;
+};
+
+static FGACustomFieldsBudget GCustomFieldsBudget;
+
+/**
+* Writes one custom field within the key and value length limits, returns false when the field was dropped
+*/
+static bool WriteBudgetedField(FGAJsonWriter& writer, const FString& key, const FJsonValue& value, int32 maxKeyLength, int32 maxValueLength)
+{
+    if (maxKeyLength > 0 && key.Len() > maxKeyLength)
+    {
+        INC_DWORD_STAT(STAT_GameAnalytics_DroppedCustomFields);
+        UE_LOG(LogGameAnalyticsAnalytics, Verbose, TEXT("Custom field %s dropped, the key is longer than %d characters"), *key, maxKeyLength);
+        return false;
+    }
+
+    if (maxValueLength > 0 && value.Type == EJson::String)
+    {
+        // the only copy of the value, WriteStringMember encodes from it directly
+        const FString stringValue = value.AsString();
+        int32 length = stringValue.Len();
+        if (length > maxValueLength)
+        {
+            length = maxValueLength;
+            // do not split a surrogate pair
+            const TCHAR last = (*stringValue)[length - 1];
+            if (last >= 0xD800 && last <= 0xDBFF)
+            {
+                --length;
+            }
+            INC_DWORD_STAT(STAT_GameAnalytics_TruncatedCustomFieldValues);
+        }
+        writer.WriteStringMember(key, *stringValue, length);
+        return true;
+    }
+
+    writer.WriteMember(key, value);
+    return true;
+}
+
+
+static thread_local TArray<const FGAScopedContext::FFragment*> GActiveContexts;
+static FGAProgressionTracker GProgressionTracker;
+static FGAAdEventDeduplicator GAdEventDeduplicator;
+static FGAErrorRateLimiter GErrorRateLimiter;
+static FGALogBridge GLogBridge;
+#if !WITH_EDITOR && !PLATFORM_IOS && !PLATFORM_ANDROID && GA_USE_CPP_SDK
+static FGAFrameTimeTracker GFrameTimeTracker;
+#endif
+/** Receipt business events still being prepared on the pool */
+static FCriticalSection GReceiptTasksLock;
+static TArray<TFuture<void>> GReceiptTasks;
+
+/**
+* Numeric field the plugin adds to an event, the event's own fields take precedence
+*/
+struct FGAExtraNumberField
+{
+    const TCHAR* Key;
+    double Value;
+};
+
+TSharedRef<const FGAScopedContext::FFragment> FGAScopedContext::MakeFragment(const TSharedRef<FJsonObject>& fields)
+{
+    TSharedRef<FFragment> fragment = MakeShared<FFragment>();
+    fragment->Keys.Reserve(fields->Values.Num());
+    fragment->Members.Reserve(fields->Values.Num());
+
+    // serialize each member on its own so events can leave out the keys they set themselves
+    FGAJsonWriter writer;
+    for (const auto& field : fields->Values)
+    {
+        if (!field.Value.IsValid())
+        {
+            continue;
+        }
+
+        writer.Reset();
+        if (!WriteBudgetedField(writer, field.Key, *field.Value, GCustomFieldsBudget.MaxKeyLength, GCustomFieldsBudget.MaxValueLength))
+        {
+            continue;
+        }
+
+        fragment->Keys.Add(field.Key);
+        fragment->Members.Emplace(writer.GetData(), writer.Len());
+    }
+
+    return fragment;
+}
+
+FGAScopedContext::FGAScopedContext(const TSharedRef<FJsonObject>& fields)
+    : FGAScopedContext(MakeFragment(fields))
+{
+}
+
+FGAScopedContext::FGAScopedContext(const TSharedRef<const FFragment>& fragment)
+    : Fragment(fragment)
+{
+    GActiveContexts.Push(&Fragment.Get());
+}
+
+FGAScopedContext::~FGAScopedContext()
+{
+    check(GActiveContexts.Num() > 0 && GActiveContexts.Last() == &Fragment.Get());
+    GActiveContexts.Pop();
+}
+
+/**
+* Serializes the custom fields of an event into the UTF-8 writer of this thread and splices in the active context fields
+*/
+static FGAJsonWriter& SerializeCustomFields(const TSharedPtr<FJsonObject>& fields, TArrayView<const FGAExtraNumberField> extraFields = TArrayView<const FGAExtraNumberField>())
+{
+    const int32 maxFields = GCustomFieldsBudget.MaxFields;
+    const int32 maxKeyLength = GCustomFieldsBudget.MaxKeyLength;
+    const int32 maxValueLength = GCustomFieldsBudget.MaxValueLength;
+    // leave room for the closing brace
+    const int32 maxLength = GCustomFieldsBudget.MaxPayloadBytes > 0 ? GCustomFieldsBudget.MaxPayloadBytes - 1 : MAX_int32;
+
+    FGAJsonWriter& writer = FGAJsonWriter::Get();
+    writer.Reset();
+    writer.BeginObject();
+
+    int32 numFields = 0;
+    int32 numDropped = 0;
+
+    // checks the count before and the payload size after a field was written, rolling it back when it does not fit
+    auto writeField = [&](TFunctionRef<bool()> write)
+    {
+        if (maxFields > 0 && numFields >= maxFields)
+        {
+            ++numDropped;
+            return;
+        }
+
+        const FGAJsonWriter::FMark mark = writer.GetMark();
+        if (!write())
+        {
+            return;
+        }
+
+        if (writer.Len() > maxLength)
+        {
+            writer.Rollback(mark);
+            ++numDropped;
+            return;
+        }
+        ++numFields;
+    };
+
+    if (fields.IsValid())
+    {
+        for (const auto& field : fields->Values)
+        {
+            if (field.Value.IsValid())
+            {
+                writeField([&]() { return WriteBudgetedField(writer, field.Key, *field.Value, maxKeyLength, maxValueLength); });
+            }
+        }
+    }
+
+    for (const FGAExtraNumberField& extraField : extraFields)
+    {
+        if (!fields.IsValid() || !fields->HasField(extraField.Key))
+        {
+            writeField([&]() { writer.WriteNumberMember(extraField.Key, extraField.Value); return true; });
+        }
+    }
+
+    if (GActiveContexts.Num() > 0)
+    {
+        TSet<FString> spliced;
+
+        for (int32 contextIndex = GActiveContexts.Num() - 1; contextIndex >= 0; --contextIndex)
+        {
+            const FGAScopedContext::FFragment& fragment = *GActiveContexts[contextIndex];
+            for (int32 i = 0; i < fragment.Keys.Num(); ++i)
+            {
+                const FString& key = fragment.Keys[i];
+                if (fields.IsValid() && fields->HasField(key))
+                {
+                    continue;
+                }
+                // only nested scopes can repeat a key
+                if (GActiveContexts.Num() > 1)
+                {
+                    bool bAlreadySpliced = false;
+                    spliced.Add(key, &bAlreadySpliced);
+                    if (bAlreadySpliced)
+                    {
+                        continue;
+                    }
+                }
+
+                writeField([&]() { writer.WriteRawMember(fragment.Members[i]); return true; });
+            }
+        }
+    }
+
+    if (numDropped > 0)
+    {
+        INC_DWORD_STAT_BY(STAT_GameAnalytics_DroppedCustomFields, numDropped);
+        UE_LOG(LogGameAnalyticsAnalytics, Verbose, TEXT("%d custom fields dropped, the event exceeds the configured custom fields limits"), numDropped);
+    }
+
+    writer.EndObject();
+    return writer;
+}
+
+/**
+* Checks currency and item type against the configured lists before the event is serialized or marshalled
+*/
+template <typename StringType>
+static bool IsResourceEventAllowed(const StringType& currency, const StringType& itemType)
+{
+    if (GResourceCurrencies.IsAllowed(currency) && GResourceItemTypes.IsAllowed(itemType))
+    {
+        return true;
+    }
+
+    INC_DWORD_STAT(STAT_GameAnalytics_RejectedResourceEvents);
+    UE_LOG(LogGameAnalyticsAnalytics, Warning, TEXT("addResourceEvent: currency or item type is not in the configured lists of available resource currencies and item types, event dropped."));
+    return false;
+}
+
 UGameAnalytics::UGameAnalytics(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
 }
 
 void UGameAnalytics::configureAvailableCustomDimensions01(const TArray<FString>& list)
 {
+    GCustomDimension01.Configure(list);
+
 #if WITH_EDITOR
     FString s = FString::Join(list, TEXT(","));
     UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::configureAvailableCustomDimensions01(%s)"), *s);
@@ -95,6 +372,8 @@ void UGameAnalytics::configureAvailableCustomDimensions01(const TArray<FString>&
 
 void UGameAnalytics::configureAvailableCustomDimensions02(const TArray<FString>& list)
 {
+    GCustomDimension02.Configure(list);
+
     std::vector<std::string> v = ToStringVector(list);
 
 #if WITH_EDITOR
@@ -122,6 +401,8 @@ void UGameAnalytics::configureAvailableCustomDimensions02(const TArray<FString>&
 
 void UGameAnalytics::configureAvailableCustomDimensions03(const TArray<FString>& list)
 {
+    GCustomDimension03.Configure(list);
+
 #if WITH_EDITOR
     FString s = FString::Join(list, TEXT(","));
     UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::configureAvailableCustomDimensions03(%s)"), *s);
@@ -162,6 +443,8 @@ void UGameAnalytics::configureAvailableCustomDimensions03(const TArray<FString>&
 
 void UGameAnalytics::configureAvailableResourceCurrencies(const TArray<FString>& list)
 {
+    GResourceCurrencies.Reset(list);
+
 #if WITH_EDITOR
     FString s = FString::Join(list, TEXT(","));
     UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::configureAvailableResourceCurrencies(%s)"), *s);
@@ -200,8 +483,21 @@ void UGameAnalytics::configureAvailableResourceCurrencies(const TArray<FString>&
 #endif
 }
 
+void UGameAnalytics::configureCustomFieldsLimits(const FGACustomFieldsLimits& limits)
+{
+    // enforced on the Unreal side only, the native SDKs never see the dropped fields
+    GCustomFieldsBudget.Set(limits);
+}
+
+void UGameAnalytics::configureErrorRateLimit(EGAErrorSeverity severity, const FGAErrorRateLimit& limit)
+{
+    GErrorRateLimiter.SetLimit(severity, limit);
+}
+
 void UGameAnalytics::configureAvailableResourceItemTypes(const TArray<FString>& list)
 {
+    GResourceItemTypes.Reset(list);
+
 #if WITH_EDITOR
     FString s = FString::Join(list, TEXT(","));
     UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::configureAvailableResourceItemTypes(%s)"), *s);
@@ -323,6 +619,133 @@ void UGameAnalytics::configureGameEngineVersion(const char *gameEngineVersion)
 #endif
 }
 
+#if WITH_EDITOR || PLATFORM_IOS || PLATFORM_ANDROID
+/**
+* Writes the configuration as one JSON object for the single backend crossing.
+* Keys are only present when the individual configure call would have been made.
+*/
+static FString SerializeConfiguration(const FGAConfiguration& configuration)
+{
+    FString configurationString;
+    TSharedRef<TJsonWriter<> > Writer = TJsonWriterFactory<>::Create(&configurationString);
+
+    Writer->WriteObjectStart();
+    Writer->WriteValue(TEXT("infoLog"), configuration.bInfoLog);
+    Writer->WriteValue(TEXT("verboseLog"), configuration.bVerboseLog);
+    if (configuration.bAutoDetectAppVersion)
+    {
+        Writer->WriteValue(TEXT("autoDetectAppVersion"), true);
+    }
+    else
+    {
+        Writer->WriteValue(TEXT("build"), configuration.Build);
+    }
+
+    auto WriteList = [&Writer](const TCHAR* key, const TArray<FString>& list)
+    {
+        if (list.Num() > 0)
+        {
+            Writer->WriteArrayStart(key);
+            for (const FString& item : list)
+            {
+                Writer->WriteValue(item);
+            }
+            Writer->WriteArrayEnd();
+        }
+    };
+    WriteList(TEXT("resourceCurrencies"), configuration.ResourceCurrencies);
+    WriteList(TEXT("resourceItemTypes"), configuration.ResourceItemTypes);
+    WriteList(TEXT("customDimensions01"), configuration.CustomDimensions01);
+    WriteList(TEXT("customDimensions02"), configuration.CustomDimensions02);
+    WriteList(TEXT("customDimensions03"), configuration.CustomDimensions03);
+
+    if (configuration.bUseManualSessionHandling)
+    {
+        Writer->WriteValue(TEXT("manualSessionHandling"), true);
+    }
+    Writer->WriteValue(TEXT("errorReporting"), configuration.bUseErrorReporting);
+    Writer->WriteObjectEnd();
+    Writer->Close();
+
+    return configurationString;
+}
+#endif
+
+void UGameAnalytics::configure(const FGAConfiguration& configuration)
+{
+    // the Unreal side validation is normally filled by the individual configure calls
+    GCustomDimension01.Configure(configuration.CustomDimensions01);
+    GCustomDimension02.Configure(configuration.CustomDimensions02);
+    GCustomDimension03.Configure(configuration.CustomDimensions03);
+    GResourceCurrencies.Reset(configuration.ResourceCurrencies);
+    GResourceItemTypes.Reset(configuration.ResourceItemTypes);
+    if (configuration.CustomFieldsLimits.IsSet())
+    {
+        GCustomFieldsBudget.Set(configuration.CustomFieldsLimits.GetValue());
+    }
+    GLogBridge.SetErrorReportingEnabled(configuration.bUseErrorReporting);
+
+#if WITH_EDITOR
+    UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::configure(%s)"), *SerializeConfiguration(configuration));
+#elif PLATFORM_IOS
+    GameAnalyticsCpp::configure(TCHAR_TO_UTF8(*SerializeConfiguration(configuration)));
+#elif PLATFORM_ANDROID
+    gameanalytics::jni_configure(TCHAR_TO_UTF8(*SerializeConfiguration(configuration)));
+#elif GA_USE_CPP_SDK
+    // no bridge to cross, apply it directly
+    gameanalytics::GameAnalytics::configureWritablePath(TCHAR_TO_UTF8(*configuration.WritablePath));
+    gameanalytics::GameAnalytics::setEnabledInfoLog(configuration.bInfoLog);
+    gameanalytics::GameAnalytics::setEnabledVerboseLog(configuration.bVerboseLog);
+    if (configuration.bDisableDeviceInfo)
+    {
+        gameanalytics::GameAnalytics::disableDeviceInfo();
+    }
+    gameanalytics::GameAnalytics::configureBuild(TCHAR_TO_UTF8(*configuration.Build));
+    if (configuration.ResourceCurrencies.Num() > 0)
+    {
+        gameanalytics::GameAnalytics::configureAvailableResourceCurrencies(ToStringVector(configuration.ResourceCurrencies));
+    }
+    if (configuration.ResourceItemTypes.Num() > 0)
+    {
+        gameanalytics::GameAnalytics::configureAvailableResourceItemTypes(ToStringVector(configuration.ResourceItemTypes));
+    }
+    if (configuration.CustomDimensions01.Num() > 0)
+    {
+        gameanalytics::GameAnalytics::configureAvailableCustomDimensions01(ToStringVector(configuration.CustomDimensions01));
+    }
+    if (configuration.CustomDimensions02.Num() > 0)
+    {
+        gameanalytics::GameAnalytics::configureAvailableCustomDimensions02(ToStringVector(configuration.CustomDimensions02));
+    }
+    if (configuration.CustomDimensions03.Num() > 0)
+    {
+        gameanalytics::GameAnalytics::configureAvailableCustomDimensions03(ToStringVector(configuration.CustomDimensions03));
+    }
+    if (configuration.bUseManualSessionHandling)
+    {
+        gameanalytics::GameAnalytics::setEnabledManualSessionHandling(true);
+    }
+    gameanalytics::GameAnalytics::setEnabledErrorReporting(configuration.bUseErrorReporting);
+// #elif PLATFORM_HTML5
+#endif
+}
+
+#if GA_USE_CPP_SDK && !WITH_EDITOR
+/**
+* Forwards refresh notifications of the C++ SDK to the game thread, where the remote configs snapshot is diffed
+*/
+struct FGARemoteConfigsListener : public gameanalytics::IRemoteConfigsListener
+{
+    virtual void onRemoteConfigsUpdated(std::string const& remoteConfigs) override
+    {
+        AsyncTask(ENamedThreads::GameThread, []()
+        {
+            UGameAnalytics::checkRemoteConfigsForChanges();
+        });
+    }
+};
+#endif
+
 void UGameAnalytics::initialize(const char *gameKey, const char *gameSecret)
 {
     ////// Configure engine version
@@ -338,527 +761,521 @@ void UGameAnalytics::initialize(const char *gameKey, const char *gameSecret)
 #elif PLATFORM_ANDROID
     gameanalytics::jni_initialize(gameKey, gameSecret);
 #elif GA_USE_CPP_SDK
+    // registered once, even if initialize is called again
+    static const std::shared_ptr<FGARemoteConfigsListener> RemoteConfigsListener = []()
+    {
+        std::shared_ptr<FGARemoteConfigsListener> listener = std::make_shared<FGARemoteConfigsListener>();
+        gameanalytics::GameAnalytics::addRemoteConfigsListener(listener);
+        return listener;
+    }();
     gameanalytics::GameAnalytics::initialize(gameKey, gameSecret);
 // #elif PLATFORM_HTML5
 //     js_initialize(gameKey, gameSecret);
 #endif
 }
 
-#if PLATFORM_IOS
-
-void UGameAnalytics::addBusinessEvent(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType, const char *receipt)
+#if WITH_EDITOR
+static const TCHAR* GetEventFunctionName(EGAEventKind kind)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    addBusinessEvent(currency, amount, itemType, itemId, cartType, receipt, fields);
+    switch (kind)
+    {
+    case EGAEventKind::BusinessAutoFetchReceipt:
+        return TEXT("addBusinessEventAndAutoFetchReceipt");
+    case EGAEventKind::Business:
+    case EGAEventKind::BusinessWithReceipt:
+    case EGAEventKind::BusinessWithSignature:
+        return TEXT("addBusinessEvent");
+    case EGAEventKind::Resource:
+        return TEXT("addResourceEvent");
+    case EGAEventKind::Progression:
+    case EGAEventKind::ProgressionWithScore:
+        return TEXT("addProgressionEvent");
+    case EGAEventKind::Design:
+    case EGAEventKind::DesignWithValue:
+        return TEXT("addDesignEvent");
+    case EGAEventKind::Error:
+        return TEXT("addErrorEvent");
+    case EGAEventKind::Ad:
+        return TEXT("addAdEvent");
+    case EGAEventKind::AdWithDuration:
+        return TEXT("addAdEventWithDuration");
+    case EGAEventKind::AdWithNoAdReason:
+        return TEXT("addAdEventWithNoAdReason");
+    default:
+        return TEXT("submitEvent");
+    }
 }
+#endif
 
-void UGameAnalytics::addBusinessEvent(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType, const char *receipt, const TSharedRef<FJsonObject> &fields)
+/**
+* Hands one event to the backend of the current platform, the only place that marshals events
+*/
+static void DispatchEvent(const FGAEventDescriptor& event, const char *fields)
 {
-    addBusinessEvent(currency, amount, itemType, itemId, cartType, receipt, fields, false);
+    const char* const* s = event.Strings;
+    const bool mergeFields = event.bMergeFields;
+
+#if WITH_EDITOR
+    FString args;
+    for (int32 i = 0; i < FGAEventDescriptor::MaxStrings; ++i)
+    {
+        if (s[i] != nullptr)
+        {
+            args += FString::Printf(TEXT("%s, "), UTF8_TO_TCHAR(s[i]));
+        }
+    }
+    UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::%s(%s%d, %d, %d, %lld, %f, %s, %d)"), GetEventFunctionName(event.Kind), *args, (int)event.Type, (int)event.SubType, (int)event.Reason, (long long)event.IntValue, event.FloatValue, UTF8_TO_TCHAR(fields), (int)mergeFields);
+#elif PLATFORM_IOS
+    switch (event.Kind)
+    {
+    case EGAEventKind::Business:
+        GameAnalyticsCpp::addBusinessEvent(s[0], (int)event.IntValue, s[1], s[2], s[3], NULL, fields, mergeFields);
+        break;
+    case EGAEventKind::BusinessWithReceipt:
+        GameAnalyticsCpp::addBusinessEvent(s[0], (int)event.IntValue, s[1], s[2], s[3], s[4], fields, mergeFields);
+        break;
+    case EGAEventKind::BusinessAutoFetchReceipt:
+        GameAnalyticsCpp::addBusinessEventAndAutoFetchReceipt(s[0], (int)event.IntValue, s[1], s[2], s[3], fields, mergeFields);
+        break;
+    case EGAEventKind::Resource:
+        GameAnalyticsCpp::addResourceEvent((int)event.Type, s[0], event.FloatValue, s[1], s[2], fields, mergeFields);
+        break;
+    case EGAEventKind::Progression:
+        GameAnalyticsCpp::addProgressionEvent((int)event.Type, s[0], s[1], s[2], fields, mergeFields);
+        break;
+    case EGAEventKind::ProgressionWithScore:
+        GameAnalyticsCpp::addProgressionEventWithScore((int)event.Type, s[0], s[1], s[2], (int)event.IntValue, fields, mergeFields);
+        break;
+    case EGAEventKind::Design:
+        GameAnalyticsCpp::addDesignEvent(s[0], fields, mergeFields);
+        break;
+    case EGAEventKind::DesignWithValue:
+        GameAnalyticsCpp::addDesignEventWithValue(s[0], event.FloatValue, fields, mergeFields);
+        break;
+    case EGAEventKind::Error:
+        GameAnalyticsCpp::addErrorEvent((int)event.Type, s[0], fields, mergeFields);
+        break;
+    case EGAEventKind::Ad:
+        GameAnalyticsCpp::addAdEvent((int)event.Type, (int)event.SubType, s[0], s[1], fields, mergeFields);
+        break;
+    case EGAEventKind::AdWithDuration:
+        GameAnalyticsCpp::addAdEventWithDuration((int)event.Type, (int)event.SubType, s[0], s[1], event.IntValue, fields, mergeFields);
+        break;
+    case EGAEventKind::AdWithNoAdReason:
+        GameAnalyticsCpp::addAdEventWithNoAdReason((int)event.Type, (int)event.SubType, s[0], s[1], (int)event.Reason, fields, mergeFields);
+        break;
+    default:
+        break;
+    }
+#elif PLATFORM_ANDROID
+    switch (event.Kind)
+    {
+    case EGAEventKind::Business:
+        gameanalytics::jni_addBusinessEvent(s[0], (int)event.IntValue, s[1], s[2], s[3], fields, mergeFields);
+        break;
+    case EGAEventKind::BusinessWithSignature:
+        gameanalytics::jni_addBusinessEventWithReceipt(s[0], (int)event.IntValue, s[1], s[2], s[3], s[4], "google_play", s[5], fields, mergeFields);
+        break;
+    case EGAEventKind::Resource:
+        gameanalytics::jni_addResourceEvent((int)event.Type, s[0], event.FloatValue, s[1], s[2], fields, mergeFields);
+        break;
+    case EGAEventKind::Progression:
+        // missing progression parts are sent as empty strings
+        gameanalytics::jni_addProgressionEvent((int)event.Type, s[0], s[1] ? s[1] : "", s[2] ? s[2] : "", fields, mergeFields);
+        break;
+    case EGAEventKind::ProgressionWithScore:
+        gameanalytics::jni_addProgressionEventWithScore((int)event.Type, s[0], s[1] ? s[1] : "", s[2] ? s[2] : "", (int)event.IntValue, fields, mergeFields);
+        break;
+    case EGAEventKind::Design:
+        gameanalytics::jni_addDesignEvent(s[0], fields, mergeFields);
+        break;
+    case EGAEventKind::DesignWithValue:
+        gameanalytics::jni_addDesignEventWithValue(s[0], event.FloatValue, fields, mergeFields);
+        break;
+    case EGAEventKind::Error:
+        gameanalytics::jni_addErrorEvent((int)event.Type, s[0], fields, mergeFields);
+        break;
+    case EGAEventKind::Ad:
+        gameanalytics::jni_addAdEvent((int)event.Type, (int)event.SubType, s[0], s[1], fields, mergeFields);
+        break;
+    case EGAEventKind::AdWithDuration:
+        gameanalytics::jni_addAdEventWithDuration((int)event.Type, (int)event.SubType, s[0], s[1], event.IntValue, fields, mergeFields);
+        break;
+    case EGAEventKind::AdWithNoAdReason:
+        gameanalytics::jni_addAdEventWithNoAdReason((int)event.Type, (int)event.SubType, s[0], s[1], (int)event.Reason, fields, mergeFields);
+        break;
+    default:
+        break;
+    }
+#elif GA_USE_CPP_SDK
+    switch (event.Kind)
+    {
+    case EGAEventKind::Business:
+        gameanalytics::GameAnalytics::addBusinessEvent(s[0], (int)event.IntValue, s[1], s[2], s[3], fields, mergeFields);
+        break;
+    case EGAEventKind::Resource:
+        gameanalytics::GameAnalytics::addResourceEvent((gameanalytics::EGAResourceFlowType)((int)event.Type), s[0], event.FloatValue, s[1], s[2], fields, mergeFields);
+        break;
+    case EGAEventKind::Progression:
+        // missing progression parts are sent as empty strings
+        gameanalytics::GameAnalytics::addProgressionEvent((gameanalytics::EGAProgressionStatus)((int)event.Type), s[0], s[1] ? s[1] : "", s[2] ? s[2] : "", fields, mergeFields);
+        break;
+    case EGAEventKind::ProgressionWithScore:
+        gameanalytics::GameAnalytics::addProgressionEvent((gameanalytics::EGAProgressionStatus)((int)event.Type), (int)event.IntValue, s[0], s[1] ? s[1] : "", s[2] ? s[2] : "", fields, mergeFields);
+        break;
+    case EGAEventKind::Design:
+        gameanalytics::GameAnalytics::addDesignEvent(s[0], fields, mergeFields);
+        break;
+    case EGAEventKind::DesignWithValue:
+        gameanalytics::GameAnalytics::addDesignEvent(s[0], event.FloatValue, fields, mergeFields);
+        break;
+    case EGAEventKind::Error:
+        gameanalytics::GameAnalytics::addErrorEvent((gameanalytics::EGAErrorSeverity)((int)event.Type), s[0], fields, mergeFields);
+        break;
+    default:
+        break;
+    }
+// #elif PLATFORM_HTML5
+#endif
 }
 
-void UGameAnalytics::addBusinessEvent(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType, const char *receipt, const TSharedRef<FJsonObject> &fields, bool mergeFields)
+/**
+* Owned copy of an event, kept until the staged events are flushed
+*/
+struct FGAStagedEvent
 {
-    FString fieldsString;
-    TSharedRef<TJsonWriter<> > Writer = TJsonWriterFactory<>::Create(&fieldsString);
-    FJsonSerializer::Serialize(fields, Writer);
+    FGAStagedEvent(const FGAEventDescriptor& descriptor, std::string&& fields)
+        : Descriptor(descriptor)
+        , Fields(MoveTemp(fields))
+    {
+        for (int32 i = 0; i < FGAEventDescriptor::MaxStrings; ++i)
+        {
+            Strings[i] = FGAStagedString(descriptor.Strings[i]);
+        }
+    }
 
-#if !WITH_EDITOR
-    GameAnalyticsCpp::addBusinessEvent(currency, amount, itemType, itemId, cartType, receipt, TCHAR_TO_UTF8(*fieldsString), mergeFields);
-#else
-    UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::addBusinessEvent(%s, %d, %s, %s, %s, %s, %s)"), UTF8_TO_TCHAR(currency), amount, UTF8_TO_TCHAR(itemType), UTF8_TO_TCHAR(itemId), UTF8_TO_TCHAR(cartType), UTF8_TO_TCHAR(receipt), *fieldsString);
-#endif
+    void Submit() const
+    {
+        FGAEventDescriptor descriptor = Descriptor;
+        for (int32 i = 0; i < FGAEventDescriptor::MaxStrings; ++i)
+        {
+            descriptor.Strings[i] = Strings[i].Get();
+        }
+        DispatchEvent(descriptor, Fields.c_str());
+    }
 
-}
+    FGAEventDescriptor Descriptor;
+    FGAStagedString Strings[FGAEventDescriptor::MaxStrings];
+    std::string Fields;
+};
 
-void UGameAnalytics::addBusinessEventAndAutoFetchReceipt(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType)
+/**
+* Flat copy of an event for a staging slot: the descriptor, each string as its length (-1 for null) followed by
+* its characters and a terminator, then the serialized custom fields and a terminator
+*/
+static void WriteStagedPayload(TArray<uint8>& payload, const FGAEventDescriptor& descriptor, const char* fields, int32 fieldsLength)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    addBusinessEventAndAutoFetchReceipt(currency, amount, itemType, itemId, cartType, fields);
+    payload.Append(reinterpret_cast<const uint8*>(&descriptor), sizeof(FGAEventDescriptor));
+    for (int32 i = 0; i < FGAEventDescriptor::MaxStrings; ++i)
+    {
+        const char* value = descriptor.Strings[i];
+        const int32 length = value != nullptr ? (int32)FCStringAnsi::Strlen(value) : -1;
+        payload.Append(reinterpret_cast<const uint8*>(&length), sizeof(int32));
+        if (value != nullptr)
+        {
+            payload.Append(reinterpret_cast<const uint8*>(value), length + 1);
+        }
+    }
+    payload.Append(reinterpret_cast<const uint8*>(fields), fieldsLength);
+    payload.Add(0);
 }
 
-void UGameAnalytics::addBusinessEventAndAutoFetchReceipt(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType, const TSharedRef<FJsonObject> &fields)
+/**
+* Rebuilds the descriptor written by WriteStagedPayload, its strings point into the payload
+*/
+static void SubmitStagedPayload(const uint8* payload, int32 size)
 {
-    addBusinessEventAndAutoFetchReceipt(currency, amount, itemType, itemId, cartType, fields, false);
+    FGAEventDescriptor descriptor(EGAEventKind::Design, false);
+    FMemory::Memcpy(&descriptor, payload, sizeof(FGAEventDescriptor));
+    const uint8* cursor = payload + sizeof(FGAEventDescriptor);
+    for (int32 i = 0; i < FGAEventDescriptor::MaxStrings; ++i)
+    {
+        int32 length;
+        FMemory::Memcpy(&length, cursor, sizeof(int32));
+        cursor += sizeof(int32);
+        descriptor.Strings[i] = length >= 0 ? reinterpret_cast<const char*>(cursor) : nullptr;
+        cursor += length >= 0 ? length + 1 : 0;
+    }
+    check(cursor < payload + size);
+    DispatchEvent(descriptor, reinterpret_cast<const char*>(cursor));
 }
 
-void UGameAnalytics::addBusinessEventAndAutoFetchReceipt(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType, const TSharedRef<FJsonObject> &fields, bool mergeFields)
-{
-    FString fieldsString;
-    TSharedRef<TJsonWriter<> > Writer = TJsonWriterFactory<>::Create(&fieldsString);
-    FJsonSerializer::Serialize(fields, Writer);
-#if !WITH_EDITOR
-    GameAnalyticsCpp::addBusinessEventAndAutoFetchReceipt(currency, amount, itemType, itemId, cartType, TCHAR_TO_UTF8(*fieldsString), mergeFields);
-#else
-    UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::addBusinessEventAndAutoFetchReceipt(%s, %d, %s, %s, %s, %s)"), UTF8_TO_TCHAR(currency), amount, UTF8_TO_TCHAR(itemType), UTF8_TO_TCHAR(itemId), UTF8_TO_TCHAR(cartType), *fieldsString);
-#endif
-}
-#elif PLATFORM_ANDROID
-void UGameAnalytics::addBusinessEvent(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType, const char *receipt, const char *signature)
+/**
+* Stages or dispatches an event whose custom fields are already serialized
+*/
+static void SubmitSerializedEvent(const FGAEventDescriptor& descriptor, const char* fields, int32 fieldsLength)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    addBusinessEvent(currency, amount, itemType, itemId, cartType, receipt, signature, fields);
+    if (FGameAnalyticsEventStaging::IsEnabled())
+    {
+        // copied into the slot's reused storage instead of owned strings
+        FGameAnalyticsEventStaging::Enqueue(&SubmitStagedPayload, [&](TArray<uint8>& payload)
+        {
+            WriteStagedPayload(payload, descriptor, fields, fieldsLength);
+        });
+        return;
+    }
+
+    DispatchEvent(descriptor, fields);
 }
 
-void UGameAnalytics::addBusinessEvent(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType, const char *receipt, const char *signature, const TSharedRef<FJsonObject> &fields)
+/**
+* Adds the number of ad events a held one stands for to its serialized custom fields
+*/
+static void AppendAdEventCount(std::string& fields, int32 count)
 {
-    addBusinessEvent(currency, amount, itemType, itemId, cartType, receipt, signature, fields, false);
+    // always an object, at least "{}"
+    fields.pop_back();
+    if (fields.size() > 1)
+    {
+        fields += ',';
+    }
+    fields += "\"ad_event_count\":";
+    fields += std::to_string(count);
+    fields += '}';
 }
 
-void UGameAnalytics::addBusinessEvent(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType, const char *receipt, const char *signature, const TSharedRef<FJsonObject> &fields, bool mergeFields)
+/**
+* Holds an ad event in the deduplication window, or submits it when the window cannot take it
+*/
+static void HoldAdEvent(const FGAEventDescriptor& descriptor, const TSharedPtr<FJsonObject>& customFields)
 {
-    FString fieldsString;
-    TSharedRef<TJsonWriter<> > Writer = TJsonWriterFactory<>::Create(&fieldsString);
-    FJsonSerializer::Serialize(fields, Writer);
-#if !WITH_EDITOR
-    gameanalytics::jni_addBusinessEventWithReceipt(currency, amount, itemType, itemId, cartType, receipt, "google_play", signature, TCHAR_TO_UTF8(*fieldsString), mergeFields);
-#else
-    UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::addBusinessEvent(%s, %d, %s, %s, %s, %s, %s, %s)"), UTF8_TO_TCHAR(currency), amount, UTF8_TO_TCHAR(itemType), UTF8_TO_TCHAR(itemId), UTF8_TO_TCHAR(cartType), UTF8_TO_TCHAR(receipt), UTF8_TO_TCHAR(signature), *fieldsString);
-#endif
+    // the custom fields are part of the key, events only coalesce when nothing about them differs
+    FGAJsonWriter& fieldsJson = SerializeCustomFields(customFields);
+    const uint64 key = FGAAdEventDeduplicator::HashKey((uint8)descriptor.Kind, descriptor.Type, descriptor.SubType, descriptor.Reason, descriptor.IntValue, descriptor.bMergeFields,
+        descriptor.Strings[0], descriptor.Strings[1], fieldsJson.GetData(), fieldsJson.Len());
+    const bool bHeld = GAdEventDeduplicator.Add(key, [&]() -> FGAAdEventDeduplicator::FSubmitFunction
+    {
+        return [event = FGAStagedEvent(descriptor, std::string(fieldsJson.GetData(), (size_t)fieldsJson.Len()))](int32 count) mutable
+        {
+            if (count > 1)
+            {
+                AppendAdEventCount(event.Fields, count);
+            }
+
+            if (FGameAnalyticsEventStaging::IsEnabled())
+            {
+                FGameAnalyticsEventStaging::Enqueue([event = MoveTemp(event)]()
+                {
+                    event.Submit();
+                });
+                return;
+            }
+            event.Submit();
+        };
+    });
+
+    if (!bHeld)
+    {
+        // already serialized, submit it from here instead of serializing again
+        SubmitSerializedEvent(descriptor, fieldsJson.GetData(), fieldsJson.Len());
+    }
 }
-#endif
 
-void UGameAnalytics::addBusinessEvent(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType)
+void UGameAnalytics::submitEvent(const FGAEventDescriptor& descriptor, const TSharedPtr<FJsonObject>& customFields)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    addBusinessEvent(currency, amount, itemType, itemId, cartType, fields);
+    if (descriptor.Kind == EGAEventKind::Resource && !IsResourceEventAllowed(descriptor.Strings[0], descriptor.Strings[1]))
+    {
+        return;
+    }
+
+    if (descriptor.Kind == EGAEventKind::Error && !GErrorRateLimiter.Allow((EGAErrorSeverity)descriptor.Type, descriptor.Strings[0]))
+    {
+        INC_DWORD_STAT(STAT_GameAnalytics_SuppressedErrorEvents);
+        return;
+    }
+
+    const bool bIsAdEvent = descriptor.Kind == EGAEventKind::Ad || descriptor.Kind == EGAEventKind::AdWithDuration || descriptor.Kind == EGAEventKind::AdWithNoAdReason;
+    if (bIsAdEvent && GAdEventDeduplicator.IsEnabled())
+    {
+        HoldAdEvent(descriptor, customFields);
+        return;
+    }
+
+    FGAProgressionTracker::FTiming timing;
+    bool bHasTiming = false;
+    if ((descriptor.Kind == EGAEventKind::Progression || descriptor.Kind == EGAEventKind::ProgressionWithScore) && GProgressionTracker.IsEnabled())
+    {
+        bHasTiming = GProgressionTracker.Track((EGAProgressionStatus)descriptor.Type, descriptor.Strings[0], descriptor.Strings[1], descriptor.Strings[2], timing);
+    }
+
+    const FGAExtraNumberField timingFields[] =
+    {
+        { TEXT("progression_elapsed_seconds"), timing.ElapsedSeconds },
+        { TEXT("progression_attempt"), (double)timing.Attempt }
+    };
+    FGAJsonWriter& fieldsJson = SerializeCustomFields(customFields, bHasTiming ? MakeArrayView(timingFields) : TArrayView<const FGAExtraNumberField>());
+    SubmitSerializedEvent(descriptor, fieldsJson.GetData(), fieldsJson.Len());
 }
 
-void UGameAnalytics::addBusinessEvent(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType, const TSharedRef<FJsonObject> &fields)
+/**
+* Reports the errors the rate limiter suppressed since the last summary as one warning, bypassing the limiter
+*/
+static void SubmitSuppressedErrorsSummary()
 {
-    addBusinessEvent(currency, amount, itemType, itemId, cartType, fields, false);
+    FGAErrorRateLimiter::FSummary summary;
+    if (!GErrorRateLimiter.ConsumeSummary(summary))
+    {
+        return;
+    }
+
+    static const TCHAR* const severityNames[(int32)EGAErrorSeverity::critical + 1] = { TEXT("undefined"), TEXT("debug"), TEXT("info"), TEXT("warning"), TEXT("error"), TEXT("critical") };
+
+    TSharedPtr<FJsonObject> fields = MakeShared<FJsonObject>();
+    fields->SetNumberField(TEXT("suppressed_errors"), summary.NumSuppressed);
+    fields->SetNumberField(TEXT("suppressed_fingerprints"), summary.NumFingerprints);
+    for (int32 i = 0; i <= (int32)EGAErrorSeverity::critical; ++i)
+    {
+        if (summary.NumSuppressedBySeverity[i] > 0)
+        {
+            fields->SetNumberField(FString::Printf(TEXT("suppressed_%s"), severityNames[i]), summary.NumSuppressedBySeverity[i]);
+        }
+    }
+
+    const FString message = FString::Printf(TEXT("GameAnalytics suppressed %d repeated error events of %d distinct errors"), summary.NumSuppressed, summary.NumFingerprints);
+    const FTCHARToUTF8 messageUtf8(*message);
+    FGAJsonWriter& fieldsJson = SerializeCustomFields(fields);
+    SubmitSerializedEvent(FGAEventDescriptor(EGAEventKind::Error, false, messageUtf8.Get()).SetType((uint8)EGAErrorSeverity::warning), fieldsJson.GetData(), fieldsJson.Len());
 }
 
-void UGameAnalytics::addBusinessEvent(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType, const TSharedRef<FJsonObject> &fields, bool mergeFields)
+void UGameAnalytics::setEnabledInfoLog(bool flag)
 {
-    FString fieldsString;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&fieldsString);
-    FJsonSerializer::Serialize(fields, Writer);
-
 #if WITH_EDITOR
-    UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::addBusinessEvent(%s, %d, %s, %s, %s, %s)"), UTF8_TO_TCHAR(currency), amount, UTF8_TO_TCHAR(itemType), UTF8_TO_TCHAR(itemId), UTF8_TO_TCHAR(cartType), *fieldsString);
+    UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::setEnabledInfoLog(%s)"), flag ? TEXT("true") : TEXT("false"));
 #elif PLATFORM_IOS
-    GameAnalyticsCpp::addBusinessEvent(currency, amount, itemType, itemId, cartType, NULL, TCHAR_TO_UTF8(*fieldsString), mergeFields);
+    GameAnalyticsCpp::setEnabledInfoLog(flag);
 #elif PLATFORM_ANDROID
-    gameanalytics::jni_addBusinessEvent(currency, amount, itemType, itemId, cartType, TCHAR_TO_UTF8(*fieldsString), mergeFields);
+    gameanalytics::jni_setEnabledInfoLog(flag);
 #elif GA_USE_CPP_SDK
-    gameanalytics::GameAnalytics::addBusinessEvent(currency, amount, itemType, itemId, cartType, TCHAR_TO_UTF8(*fieldsString), mergeFields);
-// #elif PLATFORM_HTML5
-//     js_addBusinessEvent(currency, amount, itemType, itemId, cartType, "");
+    gameanalytics::GameAnalytics::setEnabledInfoLog(flag);
+// // #elif PLATFORM_HTML5
+//     js_setEnabledInfoLog(flag);
 #endif
-
-}
-
-void UGameAnalytics::addResourceEvent(EGAResourceFlowType flowType, const char *currency, float amount, const char *itemType, const char *itemId)
-{
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    addResourceEvent(flowType, currency, amount, itemType, itemId, fields);
-}
-
-void UGameAnalytics::addResourceEvent(EGAResourceFlowType flowType, const char *currency, float amount, const char *itemType, const char *itemId, const TSharedRef<FJsonObject> &fields)
-{
-    addResourceEvent(flowType, currency, amount, itemType, itemId, fields, false);
 }
 
-void UGameAnalytics::addResourceEvent(EGAResourceFlowType flowType, const char *currency, float amount, const char *itemType, const char *itemId, const TSharedRef<FJsonObject> &fields, bool mergeFields)
+void UGameAnalytics::setEnabledVerboseLog(bool flag)
 {
-    FString fieldsString;
-    TSharedRef<TJsonWriter<> > Writer = TJsonWriterFactory<>::Create(&fieldsString);
-    FJsonSerializer::Serialize(fields, Writer);
 #if WITH_EDITOR
-    UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::addResourceEvent(%d, %s, %f, %s, %s, %s)"), (int)flowType, UTF8_TO_TCHAR(currency), amount, UTF8_TO_TCHAR(itemType), UTF8_TO_TCHAR(itemId), *fieldsString);
+    UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::setEnabledVerboseLog(%s)"), flag ? TEXT("true") : TEXT("false"));
 #elif PLATFORM_IOS
-    GameAnalyticsCpp::addResourceEvent((int)flowType, currency, amount, itemType, itemId, TCHAR_TO_UTF8(*fieldsString), mergeFields);
+    GameAnalyticsCpp::setEnabledVerboseLog(flag);
 #elif PLATFORM_ANDROID
-    gameanalytics::jni_addResourceEvent((int)flowType, currency, amount, itemType, itemId, TCHAR_TO_UTF8(*fieldsString), mergeFields);
+    gameanalytics::jni_setEnabledVerboseLog(flag);
 #elif GA_USE_CPP_SDK
-    gameanalytics::GameAnalytics::addResourceEvent((gameanalytics::EGAResourceFlowType)((int)flowType), currency, amount, itemType, itemId, TCHAR_TO_UTF8(*fieldsString), mergeFields);
-// #elif PLATFORM_HTML5
-//     js_addResourceEvent((int)flowType, currency, amount, itemType, itemId, "");
+    gameanalytics::GameAnalytics::setEnabledVerboseLog(flag);
+// // #elif PLATFORM_HTML5
+//     js_setEnabledVerboseLog(flag);
 #endif
 }
 
-void UGameAnalytics::addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01)
+void UGameAnalytics::setEnabledManualSessionHandling(bool flag)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    addProgressionEvent(progressionStatus, progression01, fields);
-}
-
-void UGameAnalytics::addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const TSharedRef<FJsonObject> &fields)
-{
-    addProgressionEvent(progressionStatus, progression01, fields, false);
-}
-
-void UGameAnalytics::addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const TSharedRef<FJsonObject> &fields, bool mergeFields)
-{
-#if PLATFORM_IOS
-    addProgressionEvent(progressionStatus, progression01, (const char *)NULL, (const char *)NULL, fields, mergeFields);
-#else
-    addProgressionEvent(progressionStatus, progression01, "", "", fields, mergeFields);
-#endif
-}
-
-void UGameAnalytics::addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, int score)
-{
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    addProgressionEvent(progressionStatus, progression01, score, fields);
-}
-
-void UGameAnalytics::addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, int score, const TSharedRef<FJsonObject> &fields)
-{
-    addProgressionEvent(progressionStatus, progression01, score, fields, false);
-}
-
-void UGameAnalytics::addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, int score, const TSharedRef<FJsonObject> &fields, bool mergeFields)
-{
-#if PLATFORM_IOS
-    addProgressionEvent(progressionStatus, progression01, (const char *)NULL, (const char *)NULL, score, fields, mergeFields);
-#else
-    addProgressionEvent(progressionStatus, progression01, "", "", score, fields, mergeFields);
-#endif
-}
-
-void UGameAnalytics::addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const char *progression02)
-{
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    addProgressionEvent(progressionStatus, progression01, progression02, fields);
-}
-
-void UGameAnalytics::addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const char *progression02, const TSharedRef<FJsonObject> &fields)
-{
-    addProgressionEvent(progressionStatus, progression01, progression02, fields, false);
-}
-
-void UGameAnalytics::addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const char *progression02, const TSharedRef<FJsonObject> &fields, bool mergeFields)
-{
-#if PLATFORM_IOS
-    addProgressionEvent(progressionStatus, progression01, progression02, (const char *)NULL, fields, mergeFields);
-#else
-    addProgressionEvent(progressionStatus, progression01, progression02, "", fields, mergeFields);
-#endif
-}
-
-void UGameAnalytics::addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const char *progression02, int score)
-{
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    addProgressionEvent(progressionStatus, progression01, progression02, score, fields);
-}
-
-void UGameAnalytics::addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const char *progression02, int score, const TSharedRef<FJsonObject> &fields)
-{
-    addProgressionEvent(progressionStatus, progression01, progression02, score, fields, false);
-}
-
-void UGameAnalytics::addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const char *progression02, int score, const TSharedRef<FJsonObject> &fields, bool mergeFields)
-{
-#if PLATFORM_IOS
-    addProgressionEvent(progressionStatus, progression01, progression02, (const char *)NULL, score, fields, mergeFields);
-#else
-    addProgressionEvent(progressionStatus, progression01, progression02, "", score, fields, mergeFields);
-#endif
-}
-
-void UGameAnalytics::addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const char *progression02, const char *progression03)
-{
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    addProgressionEvent(progressionStatus, progression01, progression02, progression03, fields);
-}
-
-void UGameAnalytics::addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const char *progression02, const char *progression03, const TSharedRef<FJsonObject> &fields)
-{
-    addProgressionEvent(progressionStatus, progression01, progression02, progression03, fields, false);
-}
-
-void UGameAnalytics::addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const char *progression02, const char *progression03, const TSharedRef<FJsonObject> &fields, bool mergeFields)
-{
-    FString fieldsString;
-    TSharedRef<TJsonWriter<> > Writer = TJsonWriterFactory<>::Create(&fieldsString);
-    FJsonSerializer::Serialize(fields, Writer);
-#if WITH_EDITOR
-    UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::addProgressionEvent(%d, %s, %s, %s, %s)"), (int)progressionStatus, UTF8_TO_TCHAR(progression01), UTF8_TO_TCHAR(progression02), UTF8_TO_TCHAR(progression03), *fieldsString);
-#elif PLATFORM_IOS
-    GameAnalyticsCpp::addProgressionEvent((int)progressionStatus, progression01, progression02, progression03, TCHAR_TO_UTF8(*fieldsString), mergeFields);
-#elif PLATFORM_ANDROID
-    gameanalytics::jni_addProgressionEvent((int)progressionStatus, progression01, progression02, progression03, TCHAR_TO_UTF8(*fieldsString), mergeFields);
-#elif GA_USE_CPP_SDK
-    gameanalytics::GameAnalytics::addProgressionEvent((gameanalytics::EGAProgressionStatus)((int)progressionStatus), progression01, progression02, progression03, TCHAR_TO_UTF8(*fieldsString), mergeFields);
-// #elif PLATFORM_HTML5
-//     js_addProgressionEvent((int)progressionStatus, progression01, progression02, progression03, "");
-#endif
-}
-
-void UGameAnalytics::addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const char *progression02, const char *progression03, int score)
-{
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    addProgressionEvent(progressionStatus, progression01, progression02, progression03, score, fields);
-}
-
-void UGameAnalytics::addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const char *progression02, const char *progression03, int score, const TSharedRef<FJsonObject> &fields)
-{
-    addProgressionEvent(progressionStatus, progression01, progression02, progression03, score, fields, false);
-}
-
-void UGameAnalytics::addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const char *progression02, const char *progression03, int score, const TSharedRef<FJsonObject> &fields, bool mergeFields)
-{
-    FString fieldsString;
-    TSharedRef<TJsonWriter<> > Writer = TJsonWriterFactory<>::Create(&fieldsString);
-    FJsonSerializer::Serialize(fields, Writer);
-
-#if WITH_EDITOR
-    UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::addProgressionEvent(%d, %s, %s, %s, %d, %s)"), (int)progressionStatus, UTF8_TO_TCHAR(progression01), UTF8_TO_TCHAR(progression02), UTF8_TO_TCHAR(progression03), score, *fieldsString);
-#elif PLATFORM_IOS
-    GameAnalyticsCpp::addProgressionEventWithScore((int)progressionStatus, progression01, progression02, progression03, score, TCHAR_TO_UTF8(*fieldsString), mergeFields);
-#elif PLATFORM_ANDROID
-    gameanalytics::jni_addProgressionEventWithScore((int)progressionStatus, progression01, progression02, progression03, score, TCHAR_TO_UTF8(*fieldsString), mergeFields);
-#elif GA_USE_CPP_SDK
-    gameanalytics::GameAnalytics::addProgressionEvent((gameanalytics::EGAProgressionStatus)((int)progressionStatus), score, progression01, progression02, progression03, TCHAR_TO_UTF8(*fieldsString), mergeFields);
-// #elif PLATFORM_HTML5
-//     js_addProgressionEventWithScore((int)progressionStatus, progression01, progression02, progression03, score, "");
-#endif
-}
-
-void UGameAnalytics::addDesignEvent(const char *eventId)
-{
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    addDesignEvent(eventId, fields);
-}
-
-void UGameAnalytics::addDesignEvent(const char *eventId, const TSharedRef<FJsonObject> &fields)
-{
-    addDesignEvent(eventId, fields, false);
-}
-
-void UGameAnalytics::addDesignEvent(const char *eventId, const TSharedRef<FJsonObject> &fields, bool mergeFields)
-{
-    FString fieldsString;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&fieldsString);
-    FJsonSerializer::Serialize(fields, Writer);
-
 #if WITH_EDITOR
-    UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::addDesignEvent(%s, %s)"), UTF8_TO_TCHAR(eventId), *fieldsString);
+    UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::setEnabledManualSessionHandling(%s)"), flag ? TEXT("true") : TEXT("false"));
 #elif PLATFORM_IOS
-    GameAnalyticsCpp::addDesignEvent(eventId, TCHAR_TO_UTF8(*fieldsString), mergeFields);
+    GameAnalyticsCpp::setEnabledManualSessionHandling(flag);
 #elif PLATFORM_ANDROID
-    gameanalytics::jni_addDesignEvent(eventId, TCHAR_TO_UTF8(*fieldsString), mergeFields);
+    gameanalytics::jni_setEnabledManualSessionHandling(flag);
 #elif GA_USE_CPP_SDK
-    gameanalytics::GameAnalytics::addDesignEvent(eventId, TCHAR_TO_UTF8(*fieldsString), mergeFields);
+    gameanalytics::GameAnalytics::setEnabledManualSessionHandling(flag);
 // #elif PLATFORM_HTML5
-//     js_addDesignEvent(eventId, "");
+//     js_setManualSessionHandling(flag);
 #endif
-
-}
-
-void UGameAnalytics::addDesignEvent(const char *eventId, float value)
-{
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    addDesignEvent(eventId, value, fields);
 }
 
-void UGameAnalytics::addDesignEvent(const char *eventId, float value, const TSharedRef<FJsonObject> &fields)
+void UGameAnalytics::setEnabledErrorReporting(bool flag)
 {
-    addDesignEvent(eventId, value, fields, false);
-}
+    GLogBridge.SetErrorReportingEnabled(flag);
 
-void UGameAnalytics::addDesignEvent(const char *eventId, float value, const TSharedRef<FJsonObject> &fields, bool mergeFields)
-{
-    FString fieldsString;
-    TSharedRef<TJsonWriter<> > Writer = TJsonWriterFactory<>::Create(&fieldsString);
-    FJsonSerializer::Serialize(fields, Writer);
 #if WITH_EDITOR
-    UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::addDesignEvent(%s, %f, %s)"), UTF8_TO_TCHAR(eventId), value, *fieldsString);
+    UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::setEnabledErrorReporting(%s)"), flag ? TEXT("true") : TEXT("false"));
 #elif PLATFORM_IOS
-    GameAnalyticsCpp::addDesignEventWithValue(eventId, value, TCHAR_TO_UTF8(*fieldsString), mergeFields);
+    GameAnalyticsCpp::setEnabledErrorReporting(flag);
 #elif PLATFORM_ANDROID
-    gameanalytics::jni_addDesignEventWithValue(eventId, value, TCHAR_TO_UTF8(*fieldsString), mergeFields);
+    gameanalytics::jni_setEnabledErrorReporting(flag);
 #elif GA_USE_CPP_SDK
-    gameanalytics::GameAnalytics::addDesignEvent(eventId, value, TCHAR_TO_UTF8(*fieldsString), mergeFields);
+    gameanalytics::GameAnalytics::setEnabledErrorReporting(flag);
 // #elif PLATFORM_HTML5
-//     js_addDesignEventWithValue(eventId, value, "");
+//     js_setEnabledErrorReporting(flag);
 #endif
 }
 
-void UGameAnalytics::addErrorEvent(EGAErrorSeverity severity, const char *message)
-{
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    addErrorEvent(severity, message, fields);
-}
-
-void UGameAnalytics::addErrorEvent(EGAErrorSeverity severity, const char *message, const TSharedRef<FJsonObject> &fields)
-{
-    addErrorEvent(severity, message, fields, false);
-}
-
-void UGameAnalytics::addErrorEvent(EGAErrorSeverity severity, const char *message, const TSharedRef<FJsonObject> &fields, bool mergeFields)
+void UGameAnalytics::setEnabledEventSubmission(bool flag)
 {
-    FString fieldsString;
-    TSharedRef<TJsonWriter<> > Writer = TJsonWriterFactory<>::Create(&fieldsString);
-    FJsonSerializer::Serialize(fields, Writer);
 #if WITH_EDITOR
-    UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::addErrorEvent(%d, %s, %s)"), (int)severity, UTF8_TO_TCHAR(message), *fieldsString);
+    UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::setEnabledEventSubmission(%s)"), flag ? TEXT("true") : TEXT("false"));
 #elif PLATFORM_IOS
-    GameAnalyticsCpp::addErrorEvent((int)severity, message, TCHAR_TO_UTF8(*fieldsString), mergeFields);
+    GameAnalyticsCpp::setEnabledEventSubmission(flag);
 #elif PLATFORM_ANDROID
-    gameanalytics::jni_addErrorEvent((int)severity, message, TCHAR_TO_UTF8(*fieldsString), mergeFields);
+    gameanalytics::jni_setEnabledEventSubmission(flag);
 #elif GA_USE_CPP_SDK
-    gameanalytics::GameAnalytics::addErrorEvent((gameanalytics::EGAErrorSeverity)((int)severity), message, TCHAR_TO_UTF8(*fieldsString), mergeFields);
+    gameanalytics::GameAnalytics::setEnabledEventSubmission(flag);
 // #elif PLATFORM_HTML5
-//     js_addErrorEvent((int)severity, message, "");
-#endif
-}
-
-#if PLATFORM_IOS || PLATFORM_ANDROID
-void UGameAnalytics::addAdEvent(EGAAdAction action, EGAAdType adType, const char *adSdkName, const char *adPlacement)
-{
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    addAdEvent(action, adType, adSdkName, adPlacement, fields);
-}
-
-void UGameAnalytics::addAdEvent(EGAAdAction action, EGAAdType adType, const char *adSdkName, const char *adPlacement, const TSharedRef<FJsonObject> &fields)
-{
-    addAdEvent(action, adType, adSdkName, adPlacement, fields, false);
-}
-
-void UGameAnalytics::addAdEvent(EGAAdAction action, EGAAdType adType, const char *adSdkName, const char *adPlacement, const TSharedRef<FJsonObject> &fields, bool mergeFields)
-{
-    FString fieldsString;
-    TSharedRef<TJsonWriter<> > Writer = TJsonWriterFactory<>::Create(&fieldsString);
-    FJsonSerializer::Serialize(fields, Writer);
-#if WITH_EDITOR
-    UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::addAdEvent(%d, %d, %s, %s, %s)"), (int)action, (int)adType, UTF8_TO_TCHAR(adSdkName), UTF8_TO_TCHAR(adPlacement), *fieldsString);
-#elif PLATFORM_IOS
-    GameAnalyticsCpp::addAdEvent((int)action, (int)action, adSdkName, adPlacement, TCHAR_TO_UTF8(*fieldsString), mergeFields);
-#elif PLATFORM_ANDROID
-    gameanalytics::jni_addAdEvent((int)action, (int)action, adSdkName, adPlacement, TCHAR_TO_UTF8(*fieldsString), mergeFields);
-#endif
-}
-
-void UGameAnalytics::addAdEventWithDuration(EGAAdAction action, EGAAdType adType, const char *adSdkName, const char *adPlacement, int64_t duration)
-{
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    addAdEventWithDuration(action, adType, adSdkName, adPlacement, duration, fields);
-}
-
-void UGameAnalytics::addAdEventWithDuration(EGAAdAction action, EGAAdType adType, const char *adSdkName, const char *adPlacement, int64_t duration, const TSharedRef<FJsonObject> &fields)
-{
-    addAdEventWithDuration(action, adType, adSdkName, adPlacement, duration, fields, false);
-}
-
-void UGameAnalytics::addAdEventWithDuration(EGAAdAction action, EGAAdType adType, const char *adSdkName, const char *adPlacement, int64_t duration, const TSharedRef<FJsonObject> &fields, bool mergeFields)
-{
-    FString fieldsString;
-    TSharedRef<TJsonWriter<> > Writer = TJsonWriterFactory<>::Create(&fieldsString);
-    FJsonSerializer::Serialize(fields, Writer);
-#if WITH_EDITOR
-    UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::addAdEventWithDuration(%d, %d, %s, %s, %d, %s)"), (int)action, (int)adType, UTF8_TO_TCHAR(adSdkName), UTF8_TO_TCHAR(adPlacement), duration, *fieldsString);
-#elif PLATFORM_IOS
-    GameAnalyticsCpp::addAdEventWithDuration((int)action, (int)action, adSdkName, adPlacement, duration, TCHAR_TO_UTF8(*fieldsString), mergeFields);
-#elif PLATFORM_ANDROID
-    gameanalytics::jni_addAdEventWithDuration((int)action, (int)action, adSdkName, adPlacement, duration, TCHAR_TO_UTF8(*fieldsString), mergeFields);
+//     js_setEventSubmission(flag);
 #endif
 }
 
-void UGameAnalytics::addAdEventWithNoAdReason(EGAAdAction action, EGAAdType adType, const char *adSdkName, const char *adPlacement, EGAAdError noAdReason)
+void UGameAnalytics::setEnabledEventStaging(bool flag)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    addAdEventWithNoAdReason(action, adType, adSdkName, adPlacement, noAdReason, fields);
+    FGameAnalyticsEventStaging::SetEnabled(flag);
 }
 
-void UGameAnalytics::addAdEventWithNoAdReason(EGAAdAction action, EGAAdType adType, const char *adSdkName, const char *adPlacement, EGAAdError noAdReason, const TSharedRef<FJsonObject> &fields)
+void UGameAnalytics::setEnabledProgressionTracking(bool flag)
 {
-    addAdEventWithNoAdReason(action, adType, adSdkName, adPlacement, noAdReason, fields, false);
+    GProgressionTracker.SetEnabled(flag);
 }
 
-void UGameAnalytics::addAdEventWithNoAdReason(EGAAdAction action, EGAAdType adType, const char *adSdkName, const char *adPlacement, EGAAdError noAdReason, const TSharedRef<FJsonObject> &fields, bool mergeFields)
+void UGameAnalytics::configureLogBridge(const TArray<FName>& categories, bool includeWarnings)
 {
-    FString fieldsString;
-    TSharedRef<TJsonWriter<> > Writer = TJsonWriterFactory<>::Create(&fieldsString);
-    FJsonSerializer::Serialize(fields, Writer);
-#if WITH_EDITOR
-    UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::addAdEventWithNoAdReason(%d, %d, %s, %s, %d, %s)"), (int)action, (int)adType, UTF8_TO_TCHAR(adSdkName), UTF8_TO_TCHAR(adPlacement), (int)noAdReason, *fieldsString);
-#elif PLATFORM_IOS
-    GameAnalyticsCpp::addAdEventWithNoAdReason((int)action, (int)action, adSdkName, adPlacement, (int)noAdReason, TCHAR_TO_UTF8(*fieldsString), mergeFields);
-#elif PLATFORM_ANDROID
-    gameanalytics::jni_addAdEventWithNoAdReason((int)action, (int)action, adSdkName, adPlacement, (int)noAdReason, TCHAR_TO_UTF8(*fieldsString), mergeFields);
-#endif
+    GLogBridge.Configure(categories, includeWarnings);
 }
-#endif
 
-void UGameAnalytics::setEnabledInfoLog(bool flag)
+void UGameAnalytics::setEnabledLogBridge(bool flag)
 {
-#if WITH_EDITOR
-    UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::setEnabledInfoLog(%s)"), flag ? TEXT("true") : TEXT("false"));
-#elif PLATFORM_IOS
-    GameAnalyticsCpp::setEnabledInfoLog(flag);
-#elif PLATFORM_ANDROID
-    gameanalytics::jni_setEnabledInfoLog(flag);
-#elif GA_USE_CPP_SDK
-    gameanalytics::GameAnalytics::setEnabledInfoLog(flag);
-// // #elif PLATFORM_HTML5
-//     js_setEnabledInfoLog(flag);
-#endif
+    GLogBridge.SetEnabled(flag);
 }
 
-void UGameAnalytics::setEnabledVerboseLog(bool flag)
+void UGameAnalytics::setAdEventDeduplicationWindow(float seconds)
 {
-#if WITH_EDITOR
-    UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::setEnabledVerboseLog(%s)"), flag ? TEXT("true") : TEXT("false"));
-#elif PLATFORM_IOS
-    GameAnalyticsCpp::setEnabledVerboseLog(flag);
-#elif PLATFORM_ANDROID
-    gameanalytics::jni_setEnabledVerboseLog(flag);
-#elif GA_USE_CPP_SDK
-    gameanalytics::GameAnalytics::setEnabledVerboseLog(flag);
-// // #elif PLATFORM_HTML5
-//     js_setEnabledVerboseLog(flag);
-#endif
+    GAdEventDeduplicator.SetWindow(FMath::Max(seconds, 0.0f));
 }
 
-void UGameAnalytics::setEnabledManualSessionHandling(bool flag)
+/**
+* Validates and caches a custom dimension, then applies it in order with the staged events.
+* Events raised before the change must not be dispatched after it, they would be tagged with the new value.
+*/
+static void SetCustomDimension(FGACustomDimension& dimension, void (*apply)(const char*), const char *customDimension)
 {
-#if WITH_EDITOR
-    UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::setEnabledManualSessionHandling(%s)"), flag ? TEXT("true") : TEXT("false"));
-#elif PLATFORM_IOS
-    GameAnalyticsCpp::setEnabledManualSessionHandling(flag);
-#elif PLATFORM_ANDROID
-    gameanalytics::jni_setEnabledManualSessionHandling(flag);
-#elif GA_USE_CPP_SDK
-    gameanalytics::GameAnalytics::setEnabledManualSessionHandling(flag);
-// #elif PLATFORM_HTML5
-//     js_setManualSessionHandling(flag);
-#endif
-}
+    if (!dimension.Update(customDimension))
+    {
+        return;
+    }
 
-void UGameAnalytics::setEnabledErrorReporting(bool flag)
-{
-#if WITH_EDITOR
-    UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::setEnabledErrorReporting(%s)"), flag ? TEXT("true") : TEXT("false"));
-#elif PLATFORM_IOS
-    GameAnalyticsCpp::setEnabledErrorReporting(flag);
-#elif PLATFORM_ANDROID
-    gameanalytics::jni_setEnabledErrorReporting(flag);
-#elif GA_USE_CPP_SDK
-    gameanalytics::GameAnalytics::setEnabledErrorReporting(flag);
-// #elif PLATFORM_HTML5
-//     js_setEnabledErrorReporting(flag);
-#endif
-}
+    if (FGameAnalyticsEventStaging::IsEnabled())
+    {
+        FGameAnalyticsEventStaging::Enqueue([apply, value = FGAStagedString(customDimension)]()
+        {
+            apply(value.Get());
+        });
+        return;
+    }
 
-void UGameAnalytics::setEnabledEventSubmission(bool flag)
-{
-#if WITH_EDITOR
-    UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::setEnabledEventSubmission(%s)"), flag ? TEXT("true") : TEXT("false"));
-#elif PLATFORM_IOS
-    GameAnalyticsCpp::setEnabledEventSubmission(flag);
-#elif PLATFORM_ANDROID
-    gameanalytics::jni_setEnabledEventSubmission(flag);
-#elif GA_USE_CPP_SDK
-    gameanalytics::GameAnalytics::setEnabledEventSubmission(flag);
-// #elif PLATFORM_HTML5
-//     js_setEventSubmission(flag);
-#endif
+    apply(customDimension);
 }
 
-void UGameAnalytics::setCustomDimension01(const char *customDimension)
+/**
+* Hand the custom dimensions to the backend, validation and caching already happened
+*/
+static void ApplyCustomDimension01(const char *customDimension)
 {
 #if WITH_EDITOR
     UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::setCustomDimension01(%s)"), UTF8_TO_TCHAR(customDimension));
@@ -873,7 +1290,12 @@ void UGameAnalytics::setCustomDimension01(const char *customDimension)
 #endif
 }
 
-void UGameAnalytics::setCustomDimension02(const char *customDimension)
+void UGameAnalytics::setCustomDimension01(const char *customDimension)
+{
+    SetCustomDimension(GCustomDimension01, &ApplyCustomDimension01, customDimension);
+}
+
+static void ApplyCustomDimension02(const char *customDimension)
 {
 #if WITH_EDITOR
     UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::setCustomDimension02(%s)"), UTF8_TO_TCHAR(customDimension));
@@ -888,7 +1310,12 @@ void UGameAnalytics::setCustomDimension02(const char *customDimension)
 #endif
 }
 
-void UGameAnalytics::setCustomDimension03(const char *customDimension)
+void UGameAnalytics::setCustomDimension02(const char *customDimension)
+{
+    SetCustomDimension(GCustomDimension02, &ApplyCustomDimension02, customDimension);
+}
+
+static void ApplyCustomDimension03(const char *customDimension)
 {
 #if WITH_EDITOR
     UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::setCustomDimension03(%s)"), UTF8_TO_TCHAR(customDimension));
@@ -903,6 +1330,11 @@ void UGameAnalytics::setCustomDimension03(const char *customDimension)
 #endif
 }
 
+void UGameAnalytics::setCustomDimension03(const char *customDimension)
+{
+    SetCustomDimension(GCustomDimension03, &ApplyCustomDimension03, customDimension);
+}
+
 void UGameAnalytics::startSession()
 {
 #if WITH_EDITOR
@@ -920,6 +1352,9 @@ void UGameAnalytics::startSession()
 
 void UGameAnalytics::endSession()
 {
+    // staged events belong to the session that is about to end
+    flushStagedEvents();
+
 #if WITH_EDITOR
     UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::endSession()"));
 #elif PLATFORM_IOS
@@ -935,6 +1370,8 @@ void UGameAnalytics::endSession()
 
 void UGameAnalytics::onQuit()
 {
+    flushStagedEvents();
+
 #if WITH_EDITOR
     UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::onQuit()"));
 #elif GA_USE_CPP_SDK
@@ -942,25 +1379,71 @@ void UGameAnalytics::onQuit()
 #endif
 }
 
+/**
+* Drops the finished receipt tasks, true when none is left
+*/
+static bool CompleteReceiptTasks(bool bWait)
+{
+    TArray<TFuture<void>> tasks;
+    {
+        FScopeLock lock(&GReceiptTasksLock);
+        if (!bWait)
+        {
+            GReceiptTasks.RemoveAll([](const TFuture<void>& task) { return task.IsReady(); });
+            return GReceiptTasks.Num() == 0;
+        }
+        tasks = MoveTemp(GReceiptTasks);
+    }
+
+    // the tasks only convert and stage, they never wait for this thread
+    for (TFuture<void>& task : tasks)
+    {
+        task.Wait();
+    }
+    return true;
+}
+
+void UGameAnalytics::flushStagedEvents()
+{
+    CompleteReceiptTasks(true);
+    // held ad events do not wait for their window when the caller asks for everything
+    GAdEventDeduplicator.Flush(false);
+    SubmitSuppressedErrorsSummary();
+    FGameAnalyticsEventStaging::sharedInstance()->Flush();
+}
+
+void UGameAnalytics::tickStagedEvents()
+{
+    GAdEventDeduplicator.Flush(true);
+    SubmitSuppressedErrorsSummary();
+
+    // a receipt event raised before the staged ones would otherwise be submitted after them, wait a frame
+    if (CompleteReceiptTasks(false))
+    {
+        FGameAnalyticsEventStaging::sharedInstance()->Flush();
+    }
+}
+
 FString UGameAnalytics::getRemoteConfigsValueAsString(const char *key)
 {
 #if WITH_EDITOR
     UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::getRemoteConfigsValueAsString(%s)"), UTF8_TO_TCHAR(key));
     return "";
 #elif PLATFORM_IOS
-	char* out = NULL;
-	GameAnalyticsCpp::getRemoteConfigsValueAsString(key, &out);
-	FString result(out);
-	delete[] out;
-	return result;
+    FString result;
+    FGAFStringSink out(result);
+    GameAnalyticsCpp::getRemoteConfigsValueAsString(key, out);
+    return result;
 #elif PLATFORM_ANDROID
-	char* out = NULL;
-	gameanalytics::jni_getRemoteConfigsValueAsString(key, &out);
-	FString result(out);
-	delete[] out;
-	return result;
+    FString result;
+    FGAFStringSink out(result);
+    gameanalytics::jni_getRemoteConfigsValueAsString(key, out);
+    return result;
 #elif GA_USE_CPP_SDK
-	return FString(gameanalytics::GameAnalytics::getRemoteConfigsValueAsString(key).data());
+    const std::string value = gameanalytics::GameAnalytics::getRemoteConfigsValueAsString(key);
+    FString result;
+    FGAFStringSink(result).SetUtf8(value.data(), (int32)value.size());
+    return result;
 // #elif PLATFORM_HTML5
 //     return FString(js_getRemoteConfigsValueAsString(key));
 #endif
@@ -972,19 +1455,20 @@ FString UGameAnalytics::getRemoteConfigsValueAsString(const char *key, const cha
     UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::getRemoteConfigsValueAsString(%s, %s)"), UTF8_TO_TCHAR(key), UTF8_TO_TCHAR(defaultValue));
     return "";
 #elif PLATFORM_IOS
-	char* out = NULL;
-    GameAnalyticsCpp::getRemoteConfigsValueAsString(key, defaultValue, &out);
-	FString result(out);
-	delete[] out;
-	return result;
+    FString result;
+    FGAFStringSink out(result);
+    GameAnalyticsCpp::getRemoteConfigsValueAsString(key, defaultValue, out);
+    return result;
 #elif PLATFORM_ANDROID
-	char* out = NULL;
-    gameanalytics::jni_getRemoteConfigsValueAsStringWithDefaultValue(key, defaultValue, &out);
-	FString result(out);
-	delete[] out;
-	return result;
+    FString result;
+    FGAFStringSink out(result);
+    gameanalytics::jni_getRemoteConfigsValueAsStringWithDefaultValue(key, defaultValue, out);
+    return result;
 #elif GA_USE_CPP_SDK
-	return FString(gameanalytics::GameAnalytics::getRemoteConfigsValueAsString(key, defaultValue).data());
+    const std::string value = gameanalytics::GameAnalytics::getRemoteConfigsValueAsString(key, defaultValue);
+    FString result;
+    FGAFStringSink(result).SetUtf8(value.data(), (int32)value.size());
+    return result;
 // #elif PLATFORM_HTML5
 //     return FString(js_getRemoteConfigsValueAsStringWithDefaultValue(key, defaultValue));
 #endif
@@ -1012,212 +1496,438 @@ FString UGameAnalytics::getRemoteConfigsContentAsString()
     UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::getRemoteConfigsContentAsString()"));
     return "";
 #elif PLATFORM_IOS
-	char* out = NULL;
-    GameAnalyticsCpp::getRemoteConfigsContentAsString(&out);
-	FString result(out);
-	delete[] out;
-	return result;
+    FString result;
+    FGAFStringSink out(result);
+    GameAnalyticsCpp::getRemoteConfigsContentAsString(out);
+    return result;
 #elif PLATFORM_ANDROID
-	char* out = NULL;
-    gameanalytics::jni_getRemoteConfigsContentAsString(&out);
-	FString result(out);
-	delete[] out;
-	return result;
+    FString result;
+    FGAFStringSink out(result);
+    gameanalytics::jni_getRemoteConfigsContentAsString(out);
+    return result;
 #elif GA_USE_CPP_SDK
-    return FString(gameanalytics::GameAnalytics::getRemoteConfigsContentAsString().data());
+    const std::string value = gameanalytics::GameAnalytics::getRemoteConfigsContentAsString();
+    FString result;
+    FGAFStringSink(result).SetUtf8(value.data(), (int32)value.size());
+    return result;
 // #elif PLATFORM_HTML5
 //     return FString(js_getRemoteConfigsContentAsString());
 #endif
 }
 
-FString UGameAnalytics::getABTestingId()
+FGAOnRemoteConfigKeyChanged UGameAnalytics::OnRemoteConfigKeyChanged;
+
+static FGARemoteConfigs GRemoteConfigs;
+static FGAABTestingCache GABTesting;
+
+void UGameAnalytics::checkRemoteConfigsForChanges()
+{
+    TArray<FGARemoteConfigs::FChange> changes;
+    GRemoteConfigs.Update(getRemoteConfigsContentAsString(), changes);
+
+    for (const FGARemoteConfigs::FChange& change : changes)
+    {
+        OnRemoteConfigKeyChanged.Broadcast(change.Key, change.OldValue, change.NewValue);
+    }
+
+    // the assignment arrives together with the remote configs
+    if (changes.Num() > 0 || !GABTesting.IsFresh())
+    {
+        refreshABTestingAssignment();
+    }
+}
+
+bool UGameAnalytics::getRemoteConfigsContent(TMap<FString, FString>& out)
+{
+    return FGARemoteConfigs::ParseContent(getRemoteConfigsContentAsString(), out);
+}
+
+void UGameAnalytics::getRemoteConfigsValues(TArrayView<const FString> keys, TArray<FString>& out)
+{
+    TMap<FString, FString> content;
+    getRemoteConfigsContent(content);
+
+    out.Reset(keys.Num());
+    for (const FString& key : keys)
+    {
+        if (const FString* value = content.Find(key))
+        {
+            out.Add(*value);
+        }
+        else
+        {
+            out.AddDefaulted();
+        }
+    }
+}
+
+FGAOnABTestingAssignmentChanged UGameAnalytics::OnABTestingAssignmentChanged;
+
+static FString FetchABTestingId()
 {
 #if WITH_EDITOR
     UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::getABTestingId()"));
     return "";
 #elif PLATFORM_IOS
-	char* out = NULL;
-    GameAnalyticsCpp::getABTestingId(&out);
-	FString result(out);
-	delete[] out;
-	return result;
+    FString result;
+    FGAFStringSink out(result);
+    GameAnalyticsCpp::getABTestingId(out);
+    return result;
 #elif PLATFORM_ANDROID
-	char* out = NULL;
-    gameanalytics::jni_getABTestingId(&out);
-	FString result(out);
-	delete[] out;
-	return result;
+    FString result;
+    FGAFStringSink out(result);
+    gameanalytics::jni_getABTestingId(out);
+    return result;
 #elif GA_USE_CPP_SDK
-    return FString(gameanalytics::GameAnalytics::getABTestingId().data());
+    const std::string value = gameanalytics::GameAnalytics::getABTestingId();
+    FString result;
+    FGAFStringSink(result).SetUtf8(value.data(), (int32)value.size());
+    return result;
 // #elif PLATFORM_HTML5
 //     return FString(js_getABTestingId());
 #endif
 }
 
-FString UGameAnalytics::getABTestingVariantId()
+static FString FetchABTestingVariantId()
 {
 #if WITH_EDITOR
     UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::getABTestingVariantId()"));
     return "";
 #elif PLATFORM_IOS
-	char* out = NULL;
-    GameAnalyticsCpp::getABTestingVariantId(&out);
-	FString result(out);
-	delete[] out;
-	return result;
+    FString result;
+    FGAFStringSink out(result);
+    GameAnalyticsCpp::getABTestingVariantId(out);
+    return result;
 #elif PLATFORM_ANDROID
-	char* out = NULL;
-    gameanalytics::jni_getABTestingVariantId(&out);
-	FString result(out);
-	delete[] out;
-	return result;
+    FString result;
+    FGAFStringSink out(result);
+    gameanalytics::jni_getABTestingVariantId(out);
+    return result;
 #elif GA_USE_CPP_SDK
-    return FString(gameanalytics::GameAnalytics::getABTestingVariantId().data());
+    const std::string value = gameanalytics::GameAnalytics::getABTestingVariantId();
+    FString result;
+    FGAFStringSink(result).SetUtf8(value.data(), (int32)value.size());
+    return result;
 // #elif PLATFORM_HTML5
 //     return FString(js_getABTestingVariantId());
 #endif
 }
 
-// Blueprint functions
+void UGameAnalytics::refreshABTestingAssignment()
+{
+    const FString id = FetchABTestingId();
+    const FString variantId = FetchABTestingVariantId();
 
-void UGameAnalytics::AddBusinessEventIOS(const FString& Currency, int Amount, const FString& ItemType, const FString& ItemId, const FString& CartType, const FString& Receipt)
+    // nothing assigned yet, keep serving the cached assignment. Once the configs are ready an empty pair means no test
+    if (id.IsEmpty() && variantId.IsEmpty() && !isRemoteConfigsReady())
+    {
+        return;
+    }
+
+    if (GABTesting.Update(id, variantId))
+    {
+        OnABTestingAssignmentChanged.Broadcast(id, variantId);
+    }
+}
+
+FString UGameAnalytics::getABTestingId()
 {
-#if PLATFORM_IOS
-    addBusinessEvent(TCHAR_TO_UTF8(*Currency), Amount, TCHAR_TO_UTF8(*ItemType), TCHAR_TO_UTF8(*ItemId), TCHAR_TO_UTF8(*CartType), TCHAR_TO_UTF8(*Receipt));
-#endif
+    if (!GABTesting.IsFresh() && isRemoteConfigsReady())
+    {
+        refreshABTestingAssignment();
+    }
+
+    FString id;
+    FString variantId;
+    GABTesting.Get(id, variantId);
+    return id;
 }
 
-void UGameAnalytics::AddBusinessEventIOSWithFields(const FString& Currency, int Amount, const FString& ItemType, const FString& ItemId, const FString& CartType, const FString& Receipt, const TArray<FGameAnalyticsCustomEventField>& CustomFields)
+FString UGameAnalytics::getABTestingVariantId()
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    for (auto item : CustomFields)
+    if (!GABTesting.IsFresh() && isRemoteConfigsReady())
     {
-        if (item.Value.IsNumeric())
-        {
-            double n = FCString::Atod(*item.Value);
-            fields->SetNumberField(item.Key, n);
+        refreshABTestingAssignment();
+    }
+
+    FString id;
+    FString variantId;
+    GABTesting.Get(id, variantId);
+    return variantId;
+}
+
+// Blueprint functions
+
+static void SetCustomField(FJsonObject& fields, const FGameAnalyticsCustomEventField& field)
+{
+    switch (field.Type)
+    {
+    case EGACustomFieldType::integer:
+        fields.SetNumberField(field.Key, (double)field.IntegerValue);
+        break;
+    case EGACustomFieldType::number:
+        fields.SetNumberField(field.Key, field.NumberValue);
+        break;
+    case EGACustomFieldType::boolean:
+        fields.SetBoolField(field.Key, field.BoolValue);
+        break;
+    case EGACustomFieldType::string:
+        fields.SetStringField(field.Key, field.Value);
+        break;
+    case EGACustomFieldType::name:
+        fields.SetStringField(field.Key, field.NameValue.ToString());
+        break;
+    default:
+        // untyped fields keep guessing from the string
+        if (field.Value.IsNumeric())
+        {
+            fields.SetNumberField(field.Key, FCString::Atod(*field.Value));
         }
         else
         {
-            fields->SetStringField(item.Key, item.Value);
+            fields.SetStringField(field.Key, field.Value);
         }
+        break;
     }
-#if PLATFORM_IOS
-    addBusinessEvent(TCHAR_TO_UTF8(*Currency), Amount, TCHAR_TO_UTF8(*ItemType), TCHAR_TO_UTF8(*ItemId), TCHAR_TO_UTF8(*CartType), TCHAR_TO_UTF8(*Receipt), fields);
-#endif
 }
 
-void UGameAnalytics::AddBusinessEventIOSWithMergeFields(const FString &Currency, int Amount, const FString &ItemType, const FString &ItemId, const FString &CartType, const FString &Receipt, const TArray<FGameAnalyticsCustomEventField> &CustomFields)
+static TSharedRef<FJsonObject> MakeCustomFields(const TArray<FGameAnalyticsCustomEventField>& customFields)
 {
     TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    for (auto item : CustomFields)
+    for (const FGameAnalyticsCustomEventField& field : customFields)
+    {
+        SetCustomField(*fields, field);
+    }
+    return fields;
+}
+
+FGameAnalyticsCustomEventField UGameAnalytics::MakeIntegerField(const FString& Key, int64 Value)
+{
+    FGameAnalyticsCustomEventField field;
+    field.Key = Key;
+    field.Type = EGACustomFieldType::integer;
+    field.IntegerValue = Value;
+    return field;
+}
+
+FGameAnalyticsCustomEventField UGameAnalytics::MakeNumberField(const FString& Key, float Value)
+{
+    FGameAnalyticsCustomEventField field;
+    field.Key = Key;
+    field.Type = EGACustomFieldType::number;
+    field.NumberValue = Value;
+    return field;
+}
+
+FGameAnalyticsCustomEventField UGameAnalytics::MakeBoolField(const FString& Key, bool Value)
+{
+    FGameAnalyticsCustomEventField field;
+    field.Key = Key;
+    field.Type = EGACustomFieldType::boolean;
+    field.BoolValue = Value;
+    return field;
+}
+
+FGameAnalyticsCustomEventField UGameAnalytics::MakeStringField(const FString& Key, const FString& Value)
+{
+    FGameAnalyticsCustomEventField field;
+    field.Key = Key;
+    field.Type = EGACustomFieldType::string;
+    field.Value = Value;
+    return field;
+}
+
+FGameAnalyticsCustomEventField UGameAnalytics::MakeNameField(const FString& Key, FName Value)
+{
+    FGameAnalyticsCustomEventField field;
+    field.Key = Key;
+    field.Type = EGACustomFieldType::name;
+    field.NameValue = Value;
+    return field;
+}
+
+/**
+* True if Value is non empty standard base64, receipts and signatures are handed to the stores in this form
+*/
+static bool IsBase64(const FString& Value)
+{
+    const int32 length = Value.Len();
+    if (length == 0 || length % 4 != 0)
     {
-        if (item.Value.IsNumeric())
+        return false;
+    }
+
+    for (int32 i = 0; i < length; ++i)
+    {
+        const TCHAR c = Value[i];
+        if (c == TEXT('='))
         {
-            double n = FCString::Atod(*item.Value);
-            fields->SetNumberField(item.Key, n);
+            // padding only at the end
+            return i >= length - 2 && (i == length - 1 || Value[length - 1] == TEXT('='));
         }
-        else
+        const bool bIsAlnum = (c >= TEXT('A') && c <= TEXT('Z')) || (c >= TEXT('a') && c <= TEXT('z')) || (c >= TEXT('0') && c <= TEXT('9'));
+        if (!bIsAlnum && c != TEXT('+') && c != TEXT('/'))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+* Business event carrying a store receipt. Receipts and signatures run to several kilobytes,
+* so they are converted to UTF-8 and checked on a pool thread instead of the calling one.
+*/
+struct FGAReceiptBusinessEvent
+{
+    EGAEventKind Kind;
+    bool bMergeFields;
+    int32 Amount;
+    uint64 Timestamp;
+    FString Currency;
+    FString ItemType;
+    FString ItemId;
+    FString CartType;
+    FString Receipt;
+    FString Signature;
+    std::string Fields;
+
+    void Stage()
+    {
+        // the store validates the receipt, a malformed one is forwarded as it is so the purchase is not lost
+        const FString& encoded = Kind == EGAEventKind::BusinessWithSignature ? Signature : Receipt;
+        if ((Kind == EGAEventKind::BusinessWithReceipt || Kind == EGAEventKind::BusinessWithSignature) && !IsBase64(encoded))
+        {
+            UE_LOG(LogGameAnalyticsAnalytics, Warning, TEXT("Business event %s has a %s that is not base64, it will likely fail validation"), *ItemId, Kind == EGAEventKind::BusinessWithSignature ? TEXT("signature") : TEXT("receipt"));
+            INC_DWORD_STAT(STAT_GameAnalytics_InvalidReceipts);
+        }
+
+        const bool bHasReceipt = Kind == EGAEventKind::BusinessWithReceipt || Kind == EGAEventKind::BusinessWithSignature;
+        const FTCHARToUTF8 currency(*Currency);
+        const FTCHARToUTF8 itemType(*ItemType);
+        const FTCHARToUTF8 itemId(*ItemId);
+        const FTCHARToUTF8 cartType(*CartType);
+        const FTCHARToUTF8 receipt(bHasReceipt ? *Receipt : TEXT(""));
+        const FTCHARToUTF8 signature(Kind == EGAEventKind::BusinessWithSignature ? *Signature : TEXT(""));
+
+        FGAEventDescriptor descriptor(Kind, bMergeFields, currency.Get(), itemType.Get(), itemId.Get(), cartType.Get(),
+            bHasReceipt ? receipt.Get() : nullptr,
+            Kind == EGAEventKind::BusinessWithSignature ? signature.Get() : nullptr);
+        descriptor.SetInt(Amount);
+
+        // always staged, so the backend is only called from the flushing thread and flushStagedEvents never misses it.
+        // With staging enabled it keeps its place among the other events
+        FGameAnalyticsEventStaging::Enqueue([event = FGAStagedEvent(descriptor, MoveTemp(Fields))]()
+        {
+            event.Submit();
+        }, Timestamp);
+
+        if (!FGameAnalyticsEventStaging::IsEnabled())
         {
-            fields->SetStringField(item.Key, item.Value);
+            // the other events go out directly, those raised after the purchase may overtake it. Send it on the game
+            // thread as soon as it is ready instead of waiting for the next tick
+            AsyncTask(ENamedThreads::GameThread, []()
+            {
+                FGameAnalyticsEventStaging::sharedInstance()->Flush();
+            });
         }
     }
+};
+
+/**
+* Serializes the custom fields on the calling thread, where the scoped context fields live, and stages the rest from the pool.
+* The strings are copied once as TCHAR and moved into the task, flushing waits for the task.
+*/
+static void SubmitReceiptBusinessEvent(EGAEventKind kind, bool bMergeFields, const FString& currency, int32 amount, const FString& itemType, const FString& itemId, const FString& cartType, FString receipt, FString signature, const TSharedPtr<FJsonObject>& customFields)
+{
+    FGAReceiptBusinessEvent event;
+    event.Kind = kind;
+    event.bMergeFields = bMergeFields;
+    event.Amount = amount;
+    event.Timestamp = FPlatformTime::Cycles64();
+    event.Currency = currency;
+    event.ItemType = itemType;
+    event.ItemId = itemId;
+    event.CartType = cartType;
+    event.Receipt = MoveTemp(receipt);
+    event.Signature = MoveTemp(signature);
+
+    FGAJsonWriter& fieldsJson = SerializeCustomFields(customFields);
+    event.Fields.assign(fieldsJson.GetData(), (size_t)fieldsJson.Len());
+
+    FScopeLock lock(&GReceiptTasksLock);
+    GReceiptTasks.Add(Async(EAsyncExecution::ThreadPool, [event = MoveTemp(event)]() mutable
+    {
+        event.Stage();
+    }));
+}
+
+void UGameAnalytics::AddBusinessEventIOS(const FString& Currency, int Amount, const FString& ItemType, const FString& ItemId, const FString& CartType, const FString& Receipt)
+{
+#if PLATFORM_IOS
+    SubmitReceiptBusinessEvent(EGAEventKind::BusinessWithReceipt, false, Currency, Amount, ItemType, ItemId, CartType, Receipt, FString(), nullptr);
+#endif
+}
+
+void UGameAnalytics::AddBusinessEventIOSWithFields(const FString& Currency, int Amount, const FString& ItemType, const FString& ItemId, const FString& CartType, const FString& Receipt, const TArray<FGameAnalyticsCustomEventField>& CustomFields)
+{
+    TSharedRef<FJsonObject> fields = MakeCustomFields(CustomFields);
+#if PLATFORM_IOS
+    SubmitReceiptBusinessEvent(EGAEventKind::BusinessWithReceipt, false, Currency, Amount, ItemType, ItemId, CartType, Receipt, FString(), fields);
+#endif
+}
+
+void UGameAnalytics::AddBusinessEventIOSWithMergeFields(const FString &Currency, int Amount, const FString &ItemType, const FString &ItemId, const FString &CartType, const FString &Receipt, const TArray<FGameAnalyticsCustomEventField> &CustomFields)
+{
+    TSharedRef<FJsonObject> fields = MakeCustomFields(CustomFields);
 #if PLATFORM_IOS
-    addBusinessEvent(TCHAR_TO_UTF8(*Currency), Amount, TCHAR_TO_UTF8(*ItemType), TCHAR_TO_UTF8(*ItemId), TCHAR_TO_UTF8(*CartType), TCHAR_TO_UTF8(*Receipt), fields, true);
+    SubmitReceiptBusinessEvent(EGAEventKind::BusinessWithReceipt, true, Currency, Amount, ItemType, ItemId, CartType, Receipt, FString(), fields);
 #endif
 }
 
 void UGameAnalytics::AddBusinessEventAndAutoFetchReceipt(const FString& Currency, int Amount, const FString& ItemType, const FString& ItemId, const FString& CartType)
 {
 #if PLATFORM_IOS
-    addBusinessEventAndAutoFetchReceipt(TCHAR_TO_UTF8(*Currency), Amount, TCHAR_TO_UTF8(*ItemType), TCHAR_TO_UTF8(*ItemId), TCHAR_TO_UTF8(*CartType));
+    SubmitReceiptBusinessEvent(EGAEventKind::BusinessAutoFetchReceipt, false, Currency, Amount, ItemType, ItemId, CartType, FString(), FString(), nullptr);
 #endif
 }
 
 void UGameAnalytics::AddBusinessEventAndAutoFetchReceiptWithFields(const FString& Currency, int Amount, const FString& ItemType, const FString& ItemId, const FString& CartType, const TArray<FGameAnalyticsCustomEventField>& CustomFields)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    for (auto& item : CustomFields)
-    {
-        if (item.Value.IsNumeric())
-        {
-            double n = FCString::Atod(*item.Value);
-            fields->SetNumberField(item.Key, n);
-        }
-        else
-        {
-            fields->SetStringField(item.Key, item.Value);
-        }
-    }
+    TSharedRef<FJsonObject> fields = MakeCustomFields(CustomFields);
 #if PLATFORM_IOS
-    addBusinessEventAndAutoFetchReceipt(TCHAR_TO_UTF8(*Currency), Amount, TCHAR_TO_UTF8(*ItemType), TCHAR_TO_UTF8(*ItemId), TCHAR_TO_UTF8(*CartType), fields);
+    SubmitReceiptBusinessEvent(EGAEventKind::BusinessAutoFetchReceipt, false, Currency, Amount, ItemType, ItemId, CartType, FString(), FString(), fields);
 #endif
 }
 
 void UGameAnalytics::AddBusinessEventAndAutoFetchReceiptWithMergeFields(const FString &Currency, int Amount, const FString &ItemType, const FString &ItemId, const FString &CartType, const TArray<FGameAnalyticsCustomEventField> &CustomFields)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    for (auto item : CustomFields)
-    {
-        if (item.Value.IsNumeric())
-        {
-            double n = FCString::Atod(*item.Value);
-            fields->SetNumberField(item.Key, n);
-        }
-        else
-        {
-            fields->SetStringField(item.Key, item.Value);
-        }
-    }
+    TSharedRef<FJsonObject> fields = MakeCustomFields(CustomFields);
 #if PLATFORM_IOS
-    addBusinessEventAndAutoFetchReceipt(TCHAR_TO_UTF8(*Currency), Amount, TCHAR_TO_UTF8(*ItemType), TCHAR_TO_UTF8(*ItemId), TCHAR_TO_UTF8(*CartType), fields, true);
+    SubmitReceiptBusinessEvent(EGAEventKind::BusinessAutoFetchReceipt, true, Currency, Amount, ItemType, ItemId, CartType, FString(), FString(), fields);
 #endif
 }
 
 void UGameAnalytics::AddBusinessEventAndroid(const FString& Currency, int Amount, const FString& ItemType, const FString& ItemId, const FString& CartType, const FString& Receipt, const FString& Signature)
 {
 #if PLATFORM_ANDROID
-    addBusinessEvent(TCHAR_TO_UTF8(*Currency), Amount, TCHAR_TO_UTF8(*ItemType), TCHAR_TO_UTF8(*ItemId), TCHAR_TO_UTF8(*CartType), TCHAR_TO_UTF8(*Receipt), TCHAR_TO_UTF8(*Signature));
+    SubmitReceiptBusinessEvent(EGAEventKind::BusinessWithSignature, false, Currency, Amount, ItemType, ItemId, CartType, Receipt, Signature, nullptr);
 #endif
 }
 
 void UGameAnalytics::AddBusinessEventAndroidWithFields(const FString& Currency, int Amount, const FString& ItemType, const FString& ItemId, const FString& CartType, const FString& Receipt, const FString& Signature, const TArray<FGameAnalyticsCustomEventField>& CustomFields)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    for (auto item : CustomFields)
-    {
-        if (item.Value.IsNumeric())
-        {
-            double n = FCString::Atod(*item.Value);
-            fields->SetNumberField(item.Key, n);
-        }
-        else
-        {
-            fields->SetStringField(item.Key, item.Value);
-        }
-    }
+    TSharedRef<FJsonObject> fields = MakeCustomFields(CustomFields);
 #if PLATFORM_ANDROID
-    addBusinessEvent(TCHAR_TO_UTF8(*Currency), Amount, TCHAR_TO_UTF8(*ItemType), TCHAR_TO_UTF8(*ItemId), TCHAR_TO_UTF8(*CartType), TCHAR_TO_UTF8(*Receipt), TCHAR_TO_UTF8(*Signature), fields);
+    SubmitReceiptBusinessEvent(EGAEventKind::BusinessWithSignature, false, Currency, Amount, ItemType, ItemId, CartType, Receipt, Signature, fields);
 #endif
 }
 
 void UGameAnalytics::AddBusinessEventAndroidWithMergeFields(const FString &Currency, int Amount, const FString &ItemType, const FString &ItemId, const FString &CartType, const FString &Receipt, const FString &Signature, const TArray<FGameAnalyticsCustomEventField> &CustomFields)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    for (auto item : CustomFields)
-    {
-        if (item.Value.IsNumeric())
-        {
-            double n = FCString::Atod(*item.Value);
-            fields->SetNumberField(item.Key, n);
-        }
-        else
-        {
-            fields->SetStringField(item.Key, item.Value);
-        }
-    }
+    TSharedRef<FJsonObject> fields = MakeCustomFields(CustomFields);
 #if PLATFORM_ANDROID
-    addBusinessEvent(TCHAR_TO_UTF8(*Currency), Amount, TCHAR_TO_UTF8(*ItemType), TCHAR_TO_UTF8(*ItemId), TCHAR_TO_UTF8(*CartType), TCHAR_TO_UTF8(*Receipt), TCHAR_TO_UTF8(*Signature), fields, true);
+    SubmitReceiptBusinessEvent(EGAEventKind::BusinessWithSignature, true, Currency, Amount, ItemType, ItemId, CartType, Receipt, Signature, fields);
 #endif
 }
 
@@ -1228,78 +1938,45 @@ void UGameAnalytics::AddBusinessEvent(const FString& Currency, int Amount, const
 
 void UGameAnalytics::AddBusinessEventWithFields(const FString& Currency, int Amount, const FString& ItemType, const FString& ItemId, const FString& CartType, const TArray<FGameAnalyticsCustomEventField>& CustomFields)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    for (auto item : CustomFields)
-    {
-        if (item.Value.IsNumeric())
-        {
-            double n = FCString::Atod(*item.Value);
-            fields->SetNumberField(item.Key, n);
-        }
-        else
-        {
-            fields->SetStringField(item.Key, item.Value);
-        }
-    }
+    TSharedRef<FJsonObject> fields = MakeCustomFields(CustomFields);
     addBusinessEvent(TCHAR_TO_UTF8(*Currency), Amount, TCHAR_TO_UTF8(*ItemType), TCHAR_TO_UTF8(*ItemId), TCHAR_TO_UTF8(*CartType), fields);
 }
 
 void UGameAnalytics::AddBusinessEventWithMergeFields(const FString &Currency, int Amount, const FString &ItemType, const FString &ItemId, const FString &CartType, const TArray<FGameAnalyticsCustomEventField> &CustomFields)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    for (auto item : CustomFields)
-    {
-        if (item.Value.IsNumeric())
-        {
-            double n = FCString::Atod(*item.Value);
-            fields->SetNumberField(item.Key, n);
-        }
-        else
-        {
-            fields->SetStringField(item.Key, item.Value);
-        }
-    }
+    TSharedRef<FJsonObject> fields = MakeCustomFields(CustomFields);
     addBusinessEvent(TCHAR_TO_UTF8(*Currency), Amount, TCHAR_TO_UTF8(*ItemType), TCHAR_TO_UTF8(*ItemId), TCHAR_TO_UTF8(*CartType), fields, true);
 }
 
 void UGameAnalytics::AddResourceEvent(EGAResourceFlowType FlowType, const FString& Currency, float Amount, const FString& ItemType, const FString& ItemId)
 {
+    if (!IsResourceEventAllowed(Currency, ItemType))
+    {
+        return;
+    }
+
     addResourceEvent(FlowType, TCHAR_TO_UTF8(*Currency), Amount, TCHAR_TO_UTF8(*ItemType), TCHAR_TO_UTF8(*ItemId));
 }
 
 void UGameAnalytics::AddResourceEventWithFields(EGAResourceFlowType FlowType, const FString& Currency, float Amount, const FString& ItemType, const FString& ItemId, const TArray<FGameAnalyticsCustomEventField>& CustomFields)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    for (auto item : CustomFields)
+    if (!IsResourceEventAllowed(Currency, ItemType))
     {
-        if (item.Value.IsNumeric())
-        {
-            double n = FCString::Atod(*item.Value);
-            fields->SetNumberField(item.Key, n);
-        }
-        else
-        {
-            fields->SetStringField(item.Key, item.Value);
-        }
+        return;
     }
+
+    TSharedRef<FJsonObject> fields = MakeCustomFields(CustomFields);
     addResourceEvent(FlowType, TCHAR_TO_UTF8(*Currency), Amount, TCHAR_TO_UTF8(*ItemType), TCHAR_TO_UTF8(*ItemId), fields);
 }
 
 void UGameAnalytics::AddResourceEventWithMergeFields(EGAResourceFlowType FlowType, const FString &Currency, float Amount, const FString &ItemType, const FString &ItemId, const TArray<FGameAnalyticsCustomEventField> &CustomFields)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    for (auto item : CustomFields)
+    if (!IsResourceEventAllowed(Currency, ItemType))
     {
-        if (item.Value.IsNumeric())
-        {
-            double n = FCString::Atod(*item.Value);
-            fields->SetNumberField(item.Key, n);
-        }
-        else
-        {
-            fields->SetStringField(item.Key, item.Value);
-        }
+        return;
     }
+
+    TSharedRef<FJsonObject> fields = MakeCustomFields(CustomFields);
     addResourceEvent(FlowType, TCHAR_TO_UTF8(*Currency), Amount, TCHAR_TO_UTF8(*ItemType), TCHAR_TO_UTF8(*ItemId), fields, true);
 }
 
@@ -1310,37 +1987,13 @@ void UGameAnalytics::AddProgressionEventWithOne(EGAProgressionStatus Progression
 
 void UGameAnalytics::AddProgressionEventWithOneAndFields(EGAProgressionStatus ProgressionStatus, const FString& Progression01, const TArray<FGameAnalyticsCustomEventField>& CustomFields)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    for (auto item : CustomFields)
-    {
-        if (item.Value.IsNumeric())
-        {
-            double n = FCString::Atod(*item.Value);
-            fields->SetNumberField(item.Key, n);
-        }
-        else
-        {
-            fields->SetStringField(item.Key, item.Value);
-        }
-    }
+    TSharedRef<FJsonObject> fields = MakeCustomFields(CustomFields);
     addProgressionEvent(ProgressionStatus, TCHAR_TO_UTF8(*Progression01), fields);
 }
 
 void UGameAnalytics::AddProgressionEventWithOneAndMergeFields(EGAProgressionStatus ProgressionStatus, const FString &Progression01, const TArray<FGameAnalyticsCustomEventField> &CustomFields)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    for (auto item : CustomFields)
-    {
-        if (item.Value.IsNumeric())
-        {
-            double n = FCString::Atod(*item.Value);
-            fields->SetNumberField(item.Key, n);
-        }
-        else
-        {
-            fields->SetStringField(item.Key, item.Value);
-        }
-    }
+    TSharedRef<FJsonObject> fields = MakeCustomFields(CustomFields);
     addProgressionEvent(ProgressionStatus, TCHAR_TO_UTF8(*Progression01), fields, true);
 }
 
@@ -1351,37 +2004,13 @@ void UGameAnalytics::AddProgressionEventWithOneAndScore(EGAProgressionStatus Pro
 
 void UGameAnalytics::AddProgressionEventWithOneScoreAndFields(EGAProgressionStatus ProgressionStatus, const FString& Progression01, int Score, const TArray<FGameAnalyticsCustomEventField>& CustomFields)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    for (auto item : CustomFields)
-    {
-        if (item.Value.IsNumeric())
-        {
-            double n = FCString::Atod(*item.Value);
-            fields->SetNumberField(item.Key, n);
-        }
-        else
-        {
-            fields->SetStringField(item.Key, item.Value);
-        }
-    }
+    TSharedRef<FJsonObject> fields = MakeCustomFields(CustomFields);
     addProgressionEvent(ProgressionStatus, TCHAR_TO_UTF8(*Progression01), Score, fields);
 }
 
 void UGameAnalytics::AddProgressionEventWithOneScoreAndMergeFields(EGAProgressionStatus ProgressionStatus, const FString &Progression01, int Score, const TArray<FGameAnalyticsCustomEventField> &CustomFields)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    for (auto& item : CustomFields)
-    {
-        if (item.Value.IsNumeric())
-        {
-            double n = FCString::Atod(*item.Value);
-            fields->SetNumberField(item.Key, n);
-        }
-        else
-        {
-            fields->SetStringField(item.Key, item.Value);
-        }
-    }
+    TSharedRef<FJsonObject> fields = MakeCustomFields(CustomFields);
     addProgressionEvent(ProgressionStatus, TCHAR_TO_UTF8(*Progression01), Score, fields, true);
 }
 
@@ -1392,37 +2021,13 @@ void UGameAnalytics::AddProgressionEventWithOneAndTwo(EGAProgressionStatus Progr
 
 void UGameAnalytics::AddProgressionEventWithOneTwoAndFields(EGAProgressionStatus ProgressionStatus, const FString& Progression01, const FString& Progression02, const TArray<FGameAnalyticsCustomEventField>& CustomFields)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    for (auto& item : CustomFields)
-    {
-        if (item.Value.IsNumeric())
-        {
-            double n = FCString::Atod(*item.Value);
-            fields->SetNumberField(item.Key, n);
-        }
-        else
-        {
-            fields->SetStringField(item.Key, item.Value);
-        }
-    }
+    TSharedRef<FJsonObject> fields = MakeCustomFields(CustomFields);
     addProgressionEvent(ProgressionStatus, TCHAR_TO_UTF8(*Progression01), TCHAR_TO_UTF8(*Progression02), fields);
 }
 
 void UGameAnalytics::AddProgressionEventWithOneTwoAndMergeFields(EGAProgressionStatus ProgressionStatus, const FString &Progression01, const FString &Progression02, const TArray<FGameAnalyticsCustomEventField> &CustomFields)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    for (auto item : CustomFields)
-    {
-        if (item.Value.IsNumeric())
-        {
-            double n = FCString::Atod(*item.Value);
-            fields->SetNumberField(item.Key, n);
-        }
-        else
-        {
-            fields->SetStringField(item.Key, item.Value);
-        }
-    }
+    TSharedRef<FJsonObject> fields = MakeCustomFields(CustomFields);
     addProgressionEvent(ProgressionStatus, TCHAR_TO_UTF8(*Progression01), TCHAR_TO_UTF8(*Progression02), fields, true);
 }
 
@@ -1433,37 +2038,13 @@ void UGameAnalytics::AddProgressionEventWithOneTwoAndScore(EGAProgressionStatus
 
 void UGameAnalytics::AddProgressionEventWithOneTwoScoreAndFields(EGAProgressionStatus ProgressionStatus, const FString& Progression01, const FString& Progression02, int Score, const TArray<FGameAnalyticsCustomEventField>& CustomFields)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    for (auto& item : CustomFields)
-    {
-        if (item.Value.IsNumeric())
-        {
-            double n = FCString::Atod(*item.Value);
-            fields->SetNumberField(item.Key, n);
-        }
-        else
-        {
-            fields->SetStringField(item.Key, item.Value);
-        }
-    }
+    TSharedRef<FJsonObject> fields = MakeCustomFields(CustomFields);
     addProgressionEvent(ProgressionStatus, TCHAR_TO_UTF8(*Progression01), TCHAR_TO_UTF8(*Progression02), Score, fields);
 }
 
 void UGameAnalytics::AddProgressionEventWithOneTwoScoreAndMergeFields(EGAProgressionStatus ProgressionStatus, const FString &Progression01, const FString &Progression02, int Score, const TArray<FGameAnalyticsCustomEventField> &CustomFields)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    for (auto& item : CustomFields)
-    {
-        if (item.Value.IsNumeric())
-        {
-            double n = FCString::Atod(*item.Value);
-            fields->SetNumberField(item.Key, n);
-        }
-        else
-        {
-            fields->SetStringField(item.Key, item.Value);
-        }
-    }
+    TSharedRef<FJsonObject> fields = MakeCustomFields(CustomFields);
     addProgressionEvent(ProgressionStatus, TCHAR_TO_UTF8(*Progression01), TCHAR_TO_UTF8(*Progression02), Score, fields, true);
 }
 
@@ -1474,37 +2055,13 @@ void UGameAnalytics::AddProgressionEventWithOneTwoAndThree(EGAProgressionStatus
 
 void UGameAnalytics::AddProgressionEventWithOneTwoThreeAndFields(EGAProgressionStatus ProgressionStatus, const FString& Progression01, const FString& Progression02, const FString& Progression03, const TArray<FGameAnalyticsCustomEventField>& CustomFields)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    for (auto item : CustomFields)
-    {
-        if (item.Value.IsNumeric())
-        {
-            double n = FCString::Atod(*item.Value);
-            fields->SetNumberField(item.Key, n);
-        }
-        else
-        {
-            fields->SetStringField(item.Key, item.Value);
-        }
-    }
+    TSharedRef<FJsonObject> fields = MakeCustomFields(CustomFields);
     addProgressionEvent(ProgressionStatus, TCHAR_TO_UTF8(*Progression01), TCHAR_TO_UTF8(*Progression02), TCHAR_TO_UTF8(*Progression03), fields);
 }
 
 void UGameAnalytics::AddProgressionEventWithOneTwoThreeAndMergeFields(EGAProgressionStatus ProgressionStatus, const FString &Progression01, const FString &Progression02, const FString &Progression03, const TArray<FGameAnalyticsCustomEventField> &CustomFields)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    for (auto item : CustomFields)
-    {
-        if (item.Value.IsNumeric())
-        {
-            double n = FCString::Atod(*item.Value);
-            fields->SetNumberField(item.Key, n);
-        }
-        else
-        {
-            fields->SetStringField(item.Key, item.Value);
-        }
-    }
+    TSharedRef<FJsonObject> fields = MakeCustomFields(CustomFields);
     addProgressionEvent(ProgressionStatus, TCHAR_TO_UTF8(*Progression01), TCHAR_TO_UTF8(*Progression02), TCHAR_TO_UTF8(*Progression03), fields, true);
 }
 
@@ -1515,37 +2072,13 @@ void UGameAnalytics::AddProgressionEventWithOneTwoThreeAndScore(EGAProgressionSt
 
 void UGameAnalytics::AddProgressionEventWithOneTwoThreeScoreAndFields(EGAProgressionStatus ProgressionStatus, const FString& Progression01, const FString& Progression02, const FString& Progression03, int Score, const TArray<FGameAnalyticsCustomEventField>& CustomFields)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    for (auto item : CustomFields)
-    {
-        if (item.Value.IsNumeric())
-        {
-            double n = FCString::Atod(*item.Value);
-            fields->SetNumberField(item.Key, n);
-        }
-        else
-        {
-            fields->SetStringField(item.Key, item.Value);
-        }
-    }
+    TSharedRef<FJsonObject> fields = MakeCustomFields(CustomFields);
     addProgressionEvent(ProgressionStatus, TCHAR_TO_UTF8(*Progression01), TCHAR_TO_UTF8(*Progression02), TCHAR_TO_UTF8(*Progression03), Score, fields);
 }
 
 void UGameAnalytics::AddProgressionEventWithOneTwoThreeScoreAndMergeFields(EGAProgressionStatus ProgressionStatus, const FString &Progression01, const FString &Progression02, const FString &Progression03, int Score, const TArray<FGameAnalyticsCustomEventField> &CustomFields)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    for (auto item : CustomFields)
-    {
-        if (item.Value.IsNumeric())
-        {
-            double n = FCString::Atod(*item.Value);
-            fields->SetNumberField(item.Key, n);
-        }
-        else
-        {
-            fields->SetStringField(item.Key, item.Value);
-        }
-    }
+    TSharedRef<FJsonObject> fields = MakeCustomFields(CustomFields);
     addProgressionEvent(ProgressionStatus, TCHAR_TO_UTF8(*Progression01), TCHAR_TO_UTF8(*Progression02), TCHAR_TO_UTF8(*Progression03), Score, fields, true);
 }
 
@@ -1556,37 +2089,13 @@ void UGameAnalytics::AddDesignEvent(const FString& EventId)
 
 void UGameAnalytics::AddDesignEventWithFields(const FString& EventId, const TArray<FGameAnalyticsCustomEventField>& CustomFields)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    for (auto& item : CustomFields)
-    {
-        if (item.Value.IsNumeric())
-        {
-            double n = FCString::Atod(*item.Value);
-            fields->SetNumberField(item.Key, n);
-        }
-        else
-        {
-            fields->SetStringField(item.Key, item.Value);
-        }
-    }
+    TSharedRef<FJsonObject> fields = MakeCustomFields(CustomFields);
     addDesignEvent(TCHAR_TO_UTF8(*EventId), fields);
 }
 
 void UGameAnalytics::AddDesignEventWithMergeFields(const FString &EventId, const TArray<FGameAnalyticsCustomEventField> &CustomFields)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    for (auto& item : CustomFields)
-    {
-        if (item.Value.IsNumeric())
-        {
-            double n = FCString::Atod(*item.Value);
-            fields->SetNumberField(item.Key, n);
-        }
-        else
-        {
-            fields->SetStringField(item.Key, item.Value);
-        }
-    }
+    TSharedRef<FJsonObject> fields = MakeCustomFields(CustomFields);
     addDesignEvent(TCHAR_TO_UTF8(*EventId), fields, true);
 }
 
@@ -1597,37 +2106,13 @@ void UGameAnalytics::AddDesignEventWithValue(const FString& EventId, float Value
 
 void UGameAnalytics::AddDesignEventWithValueAndFields(const FString& EventId, float Value, const TArray<FGameAnalyticsCustomEventField>& CustomFields)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    for (auto& item : CustomFields)
-    {
-        if (item.Value.IsNumeric())
-        {
-            double n = FCString::Atod(*item.Value);
-            fields->SetNumberField(item.Key, n);
-        }
-        else
-        {
-            fields->SetStringField(item.Key, item.Value);
-        }
-    }
+    TSharedRef<FJsonObject> fields = MakeCustomFields(CustomFields);
     addDesignEvent(TCHAR_TO_UTF8(*EventId), Value, fields);
 }
 
 void UGameAnalytics::AddDesignEventWithValueAndMergeFields(const FString &EventId, float Value, const TArray<FGameAnalyticsCustomEventField> &CustomFields)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    for (auto& item : CustomFields)
-    {
-        if (item.Value.IsNumeric())
-        {
-            double n = FCString::Atod(*item.Value);
-            fields->SetNumberField(item.Key, n);
-        }
-        else
-        {
-            fields->SetStringField(item.Key, item.Value);
-        }
-    }
+    TSharedRef<FJsonObject> fields = MakeCustomFields(CustomFields);
     addDesignEvent(TCHAR_TO_UTF8(*EventId), Value, fields, true);
 }
 
@@ -1638,37 +2123,13 @@ void UGameAnalytics::AddErrorEvent(EGAErrorSeverity Severity, const FString& Mes
 
 void UGameAnalytics::AddErrorEventWithFields(EGAErrorSeverity Severity, const FString& Message, const TArray<FGameAnalyticsCustomEventField>& CustomFields)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    for (auto& item : CustomFields)
-    {
-        if (item.Value.IsNumeric())
-        {
-            double n = FCString::Atod(*item.Value);
-            fields->SetNumberField(item.Key, n);
-        }
-        else
-        {
-            fields->SetStringField(item.Key, item.Value);
-        }
-    }
+    TSharedRef<FJsonObject> fields = MakeCustomFields(CustomFields);
     addErrorEvent(Severity, TCHAR_TO_UTF8(*Message), fields);
 }
 
 void UGameAnalytics::AddErrorEventWithMergeFields(EGAErrorSeverity Severity, const FString &Message, const TArray<FGameAnalyticsCustomEventField> &CustomFields)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    for (auto& item : CustomFields)
-    {
-        if (item.Value.IsNumeric())
-        {
-            double n = FCString::Atod(*item.Value);
-            fields->SetNumberField(item.Key, n);
-        }
-        else
-        {
-            fields->SetStringField(item.Key, item.Value);
-        }
-    }
+    TSharedRef<FJsonObject> fields = MakeCustomFields(CustomFields);
     addErrorEvent(Severity, TCHAR_TO_UTF8(*Message), fields, true);
 }
 
@@ -1681,19 +2142,7 @@ void UGameAnalytics::AddAdEvent(EGAAdAction action, EGAAdType adType, const FStr
 
 void UGameAnalytics::AddAdEventWithFields(EGAAdAction action, EGAAdType adType, const FString& adSdkName, const FString& adPlacement, const TArray<FGameAnalyticsCustomEventField>& CustomFields)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    for (auto& item : CustomFields)
-    {
-        if (item.Value.IsNumeric())
-        {
-            double n = FCString::Atod(*item.Value);
-            fields->SetNumberField(item.Key, n);
-        }
-        else
-        {
-            fields->SetStringField(item.Key, item.Value);
-        }
-    }
+    TSharedRef<FJsonObject> fields = MakeCustomFields(CustomFields);
 #if PLATFORM_IOS || PLATFORM_ANDROID
     addAdEvent(action, adType, TCHAR_TO_UTF8(*adSdkName), TCHAR_TO_UTF8(*adPlacement), fields);
 #endif
@@ -1701,19 +2150,7 @@ void UGameAnalytics::AddAdEventWithFields(EGAAdAction action, EGAAdType adType,
 
 void UGameAnalytics::AddAdEventWithMergeFields(EGAAdAction action, EGAAdType adType, const FString &adSdkName, const FString &adPlacement, const TArray<FGameAnalyticsCustomEventField> &CustomFields)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    for (auto& item : CustomFields)
-    {
-        if (item.Value.IsNumeric())
-        {
-            double n = FCString::Atod(*item.Value);
-            fields->SetNumberField(item.Key, n);
-        }
-        else
-        {
-            fields->SetStringField(item.Key, item.Value);
-        }
-    }
+    TSharedRef<FJsonObject> fields = MakeCustomFields(CustomFields);
 #if PLATFORM_IOS || PLATFORM_ANDROID
     addAdEvent(action, adType, TCHAR_TO_UTF8(*adSdkName), TCHAR_TO_UTF8(*adPlacement), fields, true);
 #endif
@@ -1728,19 +2165,7 @@ void UGameAnalytics::AddAdEventWithDuration(EGAAdAction action, EGAAdType adType
 
 void UGameAnalytics::AddAdEventWithDurationAndFields(EGAAdAction action, EGAAdType adType, const FString& adSdkName, const FString& adPlacement, int64 duration, const TArray<FGameAnalyticsCustomEventField>& CustomFields)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    for (auto& item : CustomFields)
-    {
-        if (item.Value.IsNumeric())
-        {
-            double n = FCString::Atod(*item.Value);
-            fields->SetNumberField(item.Key, n);
-        }
-        else
-        {
-            fields->SetStringField(item.Key, item.Value);
-        }
-    }
+    TSharedRef<FJsonObject> fields = MakeCustomFields(CustomFields);
 #if PLATFORM_IOS || PLATFORM_ANDROID
     addAdEventWithDuration(action, adType, TCHAR_TO_UTF8(*adSdkName), TCHAR_TO_UTF8(*adPlacement), duration, fields);
 #endif
@@ -1748,19 +2173,7 @@ void UGameAnalytics::AddAdEventWithDurationAndFields(EGAAdAction action, EGAAdTy
 
 void UGameAnalytics::AddAdEventWithDurationAndMergeFields(EGAAdAction action, EGAAdType adType, const FString &adSdkName, const FString &adPlacement, int64 duration, const TArray<FGameAnalyticsCustomEventField> &CustomFields)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    for (auto& item : CustomFields)
-    {
-        if (item.Value.IsNumeric())
-        {
-            double n = FCString::Atod(*item.Value);
-            fields->SetNumberField(item.Key, n);
-        }
-        else
-        {
-            fields->SetStringField(item.Key, item.Value);
-        }
-    }
+    TSharedRef<FJsonObject> fields = MakeCustomFields(CustomFields);
 #if PLATFORM_IOS || PLATFORM_ANDROID
     addAdEventWithDuration(action, adType, TCHAR_TO_UTF8(*adSdkName), TCHAR_TO_UTF8(*adPlacement), duration, fields, true);
 #endif
@@ -1775,19 +2188,7 @@ void UGameAnalytics::AddAdEventWithNoAdReason(EGAAdAction action, EGAAdType adTy
 
 void UGameAnalytics::AddAdEventWithNoAdReasonAndFields(EGAAdAction action, EGAAdType adType, const FString& adSdkName, const FString& adPlacement, EGAAdError noAdReason, const TArray<FGameAnalyticsCustomEventField>& CustomFields)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    for (auto& item : CustomFields)
-    {
-        if (item.Value.IsNumeric())
-        {
-            double n = FCString::Atod(*item.Value);
-            fields->SetNumberField(item.Key, n);
-        }
-        else
-        {
-            fields->SetStringField(item.Key, item.Value);
-        }
-    }
+    TSharedRef<FJsonObject> fields = MakeCustomFields(CustomFields);
 #if PLATFORM_IOS || PLATFORM_ANDROID
     addAdEventWithNoAdReason(action, adType, TCHAR_TO_UTF8(*adSdkName), TCHAR_TO_UTF8(*adPlacement), noAdReason, fields);
 #endif
@@ -1795,19 +2196,7 @@ void UGameAnalytics::AddAdEventWithNoAdReasonAndFields(EGAAdAction action, EGAAd
 
 void UGameAnalytics::AddAdEventWithNoAdReasonAndMergeFields(EGAAdAction action, EGAAdType adType, const FString &adSdkName, const FString &adPlacement, EGAAdError noAdReason, const TArray<FGameAnalyticsCustomEventField> &CustomFields)
 {
-    TSharedRef<FJsonObject> fields = MakeShareable(new FJsonObject());
-    for (auto& item : CustomFields)
-    {
-        if (item.Value.IsNumeric())
-        {
-            double n = FCString::Atod(*item.Value);
-            fields->SetNumberField(item.Key, n);
-        }
-        else
-        {
-            fields->SetStringField(item.Key, item.Value);
-        }
-    }
+    TSharedRef<FJsonObject> fields = MakeCustomFields(CustomFields);
 #if PLATFORM_IOS || PLATFORM_ANDROID
     addAdEventWithNoAdReason(action, adType, TCHAR_TO_UTF8(*adSdkName), TCHAR_TO_UTF8(*adPlacement), noAdReason, fields, true);
 #endif
@@ -1853,6 +2242,18 @@ FString UGameAnalytics::GetRemoteConfigsContentAsString()
     return getRemoteConfigsContentAsString();
 }
 
+TMap<FString, FString> UGameAnalytics::GetRemoteConfigsContent()
+{
+    TMap<FString, FString> Content;
+    getRemoteConfigsContent(Content);
+    return Content;
+}
+
+void UGameAnalytics::GetRemoteConfigsValues(TArrayView<const FString> Keys, TArray<FString>& Out)
+{
+    getRemoteConfigsValues(Keys, Out);
+}
+
 FString UGameAnalytics::GetABTestingId()
 {
     return getABTestingId();
@@ -1881,21 +2282,22 @@ void UGameAnalytics::EnableSDKInitEvent(bool value)
 
 void UGameAnalytics::EnableFpsHistogram(bool value)
 {
-    #ifdef GAMEANALYTICS_ENABLE_EXPERIMENTAL
-        #if WITH_EDITOR
-            UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::EnableFpsHistogram %s"), value ? TEXT("true") : TEXT("false"));
-        #elif PLATFORM_ANDROID
-            return gameanalytics::jni_enableFpsHistogram(value);
-        #elif PLATFORM_IOS
-            return GameAnalyticsCpp::enableFpsHistogram(value);
-        #elif GA_USE_CPP_SDK
-            return gameanalytics::GameAnalytics::enableFpsHistogram(value);
-        #else
-            (void)value;
-            UE_LOG(LogGameAnalyticsAnalytics, Warning, TEXT("Health event is not supported on this platform."));
-        #endif
-    #else
+    #if WITH_EDITOR
+        UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("UGameAnalytics::EnableFpsHistogram %s"), value ? TEXT("true") : TEXT("false"));
+    #elif (PLATFORM_ANDROID || PLATFORM_IOS) && !defined(GAMEANALYTICS_ENABLE_EXPERIMENTAL)
+        (void)value;
         UE_LOG(LogGameAnalyticsAnalytics, Warning, TEXT("This feature is currently not fully supported for Unreal Engine builds."));
+    #elif PLATFORM_ANDROID
+        return gameanalytics::jni_enableFpsHistogram(value);
+    #elif PLATFORM_IOS
+        return GameAnalyticsCpp::enableFpsHistogram(value);
+    #elif GA_USE_CPP_SDK
+        // the C++ SDK has no frame source of its own, it samples the engine's frame ends through the tracker
+        GFrameTimeTracker.SetEnabled(value);
+        return gameanalytics::GameAnalytics::enableFPSHistogram([]() { return GFrameTimeTracker.Sample(); }, value);
+    #else
+        (void)value;
+        UE_LOG(LogGameAnalyticsAnalytics, Warning, TEXT("Health event is not supported on this platform."));
     #endif
 }
 
@@ -0,0 +1,126 @@
+#include "GameAnalyticsABTesting.h"
+#include "GameAnalytics.h"
+#include "Misc/Paths.h"
+#include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
+#include "Misc/ScopeLock.h"
+#include "Async/Async.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/JsonSerializer.h"
+#include "Runtime/Launch/Resources/Version.h"
+
+void FGAABTestingCache::Get(FString& OutId, FString& OutVariantId)
+{
+    FScopeLock ScopeLock(&Lock);
+    LoadIfNeeded();
+    OutId = Id;
+    OutVariantId = VariantId;
+}
+
+bool FGAABTestingCache::IsFresh()
+{
+    FScopeLock ScopeLock(&Lock);
+    return bFresh;
+}
+
+bool FGAABTestingCache::Update(const FString& InId, const FString& InVariantId)
+{
+    FScopeLock ScopeLock(&Lock);
+    LoadIfNeeded();
+    bFresh = true;
+
+    if (Id.Equals(InId, ESearchCase::CaseSensitive) && VariantId.Equals(InVariantId, ESearchCase::CaseSensitive))
+    {
+        return false;
+    }
+
+    Id = InId;
+    VariantId = InVariantId;
+
+    // replaces content a running write has not picked up yet, only the latest assignment matters
+    FString CacheContent;
+    if (!Id.IsEmpty() || !VariantId.IsEmpty())
+    {
+        TSharedRef<TJsonWriter<> > Writer = TJsonWriterFactory<>::Create(&CacheContent);
+        Writer->WriteObjectStart();
+        Writer->WriteValue(TEXT("id"), Id);
+        Writer->WriteValue(TEXT("variantId"), VariantId);
+        Writer->WriteObjectEnd();
+        Writer->Close();
+    }
+    PendingContent = MoveTemp(CacheContent);
+
+    // keep the file write off the calling thread
+    if (!bWriteScheduled)
+    {
+        bWriteScheduled = true;
+        Async(EAsyncExecution::ThreadPool, [this]()
+        {
+            WritePending();
+        });
+    }
+
+    return true;
+}
+
+void FGAABTestingCache::WritePending()
+{
+    for (;;)
+    {
+        FString CacheContent;
+        {
+            FScopeLock ScopeLock(&Lock);
+            if (!PendingContent.IsSet())
+            {
+                bWriteScheduled = false;
+                return;
+            }
+            CacheContent = MoveTemp(PendingContent.GetValue());
+            PendingContent.Reset();
+        }
+
+        if (CacheContent.IsEmpty())
+        {
+            // no assignment, a stale file must not be served on the next start
+            IFileManager::Get().Delete(*GetCacheFilePath(), false, false, true);
+        }
+        else if (!FFileHelper::SaveStringToFile(CacheContent, *GetCacheFilePath()))
+        {
+            UE_LOG(LogGameAnalyticsAnalytics, Warning, TEXT("Failed to write the A/B testing assignment cache to %s"), *GetCacheFilePath());
+        }
+    }
+}
+
+void FGAABTestingCache::LoadIfNeeded()
+{
+    if (bLoaded)
+    {
+        return;
+    }
+    bLoaded = true;
+
+    FString CacheContent;
+    if (!FFileHelper::LoadFileToString(CacheContent, *GetCacheFilePath()))
+    {
+        return;
+    }
+
+    TSharedPtr<FJsonObject> CacheObject;
+    TSharedRef<TJsonReader<> > Reader = TJsonReaderFactory<>::Create(CacheContent);
+    if (FJsonSerializer::Deserialize(Reader, CacheObject) && CacheObject.IsValid())
+    {
+        CacheObject->TryGetStringField(TEXT("id"), Id);
+        CacheObject->TryGetStringField(TEXT("variantId"), VariantId);
+    }
+}
+
+FString FGAABTestingCache::GetCacheFilePath()
+{
+#if (ENGINE_MAJOR_VERSION >= 4 && ENGINE_MINOR_VERSION >= 18) || (ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 0)
+    return FPaths::ProjectSavedDir() + TEXT("Analytics/GameAnalyticsABTesting.json");
+#else
+    return FPaths::GameSavedDir() + TEXT("Analytics/GameAnalyticsABTesting.json");
+#endif
+}
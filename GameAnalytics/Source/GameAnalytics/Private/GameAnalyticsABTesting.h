@@ -0,0 +1,44 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+/**
+ * Last known A/B testing assignment, persisted under Saved/Analytics.
+ * Served synchronously from the first frame, before the remote configs of the new session are ready,
+ * and replaced as soon as the native SDK reports an assignment.
+ */
+class FGAABTestingCache
+{
+public:
+    /** Cached id and variant id, loaded from disk on first use */
+    void Get(FString& OutId, FString& OutVariantId);
+
+    /** True once an assignment was received from the native SDK during this run */
+    bool IsFresh();
+
+    /**
+     * Stores an assignment received from the native SDK and writes it to disk when it changed.
+     * An empty id and variant id mean the player is in no test, the cache file is then deleted.
+     * @return true when it differs from the cached assignment
+     */
+    bool Update(const FString& Id, const FString& VariantId);
+
+private:
+    void LoadIfNeeded();
+
+    /** Writes the pending content until none is left, a single task at a time so the latest assignment always lands last */
+    void WritePending();
+
+    static FString GetCacheFilePath();
+
+    FCriticalSection Lock;
+    FString Id;
+    FString VariantId;
+    bool bLoaded = false;
+    bool bFresh = false;
+
+    /** Latest content not yet on disk, unset when the file is up to date and empty when it is to be deleted */
+    TOptional<FString> PendingContent;
+    bool bWriteScheduled = false;
+};
@@ -0,0 +1,138 @@
+#include "GameAnalyticsAdDeduplication.h"
+#include "Hash/CityHash.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/CString.h"
+#include "HAL/PlatformTime.h"
+
+void FGAAdEventDeduplicator::SetWindow(double Seconds)
+{
+    const bool bEnabled = Seconds > 0.0;
+    {
+        FScopeLock ScopeLock(&Lock);
+        Window = Seconds;
+        if (bEnabled && Entries.Num() == 0)
+        {
+            Entries.SetNum(Capacity);
+        }
+        bIsEnabled.store(bEnabled, std::memory_order_relaxed);
+    }
+
+    if (!bEnabled)
+    {
+        Flush(false);
+
+        FScopeLock ScopeLock(&Lock);
+        if (!bIsEnabled.load(std::memory_order_relaxed))
+        {
+            Entries.Empty();
+        }
+    }
+}
+
+bool FGAAdEventDeduplicator::Add(uint64 KeyHash, TFunctionRef<FSubmitFunction()> MakeSubmit)
+{
+    FScopeLock ScopeLock(&Lock);
+    // checked again under the lock, an event taken after SetWindow(0) flushed would never be submitted
+    if (!bIsEnabled.load(std::memory_order_relaxed) || Entries.Num() == 0)
+    {
+        return false;
+    }
+
+    FEntry* Entry = FindSlot(KeyHash);
+    if (Entry == nullptr)
+    {
+        return false;
+    }
+
+    if (Entry->KeyHash == KeyHash)
+    {
+        Entry->Count++;
+        return true;
+    }
+
+    Entry->KeyHash = KeyHash;
+    Entry->FirstSeen = FPlatformTime::Seconds();
+    Entry->Count = 1;
+    Entry->Submit = MakeSubmit();
+    NumEntries++;
+    return true;
+}
+
+void FGAAdEventDeduplicator::Flush(bool bExpiredOnly)
+{
+    TArray<FEntry, TInlineAllocator<8>> Expired;
+    {
+        FScopeLock ScopeLock(&Lock);
+        if (NumEntries == 0)
+        {
+            return;
+        }
+
+        const double Now = FPlatformTime::Seconds();
+        for (FEntry& Entry : Entries)
+        {
+            if (Entry.KeyHash != 0 && (!bExpiredOnly || Now - Entry.FirstSeen >= Window))
+            {
+                Expired.Add(MoveTemp(Entry));
+                Entry = FEntry();
+                NumEntries--;
+            }
+        }
+
+        // reinserting the survivors keeps every probe sequence free of holes
+        if (Expired.Num() > 0 && NumEntries > 0)
+        {
+            TArray<FEntry> Remaining;
+            Remaining.Reserve(NumEntries);
+            for (FEntry& Entry : Entries)
+            {
+                if (Entry.KeyHash != 0)
+                {
+                    Remaining.Add(MoveTemp(Entry));
+                    Entry = FEntry();
+                }
+            }
+            for (FEntry& Entry : Remaining)
+            {
+                *FindSlot(Entry.KeyHash) = MoveTemp(Entry);
+            }
+        }
+    }
+
+    // submitted outside the lock, submitting may raise further ad events
+    for (FEntry& Entry : Expired)
+    {
+        Entry.Submit(Entry.Count);
+    }
+}
+
+uint64 FGAAdEventDeduplicator::HashKey(uint8 Kind, uint8 Action, uint8 AdType, uint8 NoAdReason, int64 Duration, bool bMergeFields, const ANSICHAR* AdSdkName, const ANSICHAR* AdPlacement, const ANSICHAR* Fields, int32 FieldsLength)
+{
+    const uint64 Seed = ((uint64)Kind << 32) | ((uint64)Action << 24) | ((uint64)AdType << 16) | ((uint64)NoAdReason << 8) | (uint64)bMergeFields;
+    uint64 Hash = CityHash64WithSeed(reinterpret_cast<const char*>(&Duration), sizeof(Duration), Seed);
+
+    // each part seeds the hash of the next, moving characters from one part to the other changes the key
+    const ANSICHAR* SdkName = AdSdkName != nullptr ? AdSdkName : "";
+    const ANSICHAR* Placement = AdPlacement != nullptr ? AdPlacement : "";
+    Hash = CityHash64WithSeed(SdkName, FCStringAnsi::Strlen(SdkName), Hash + 1);
+    Hash = CityHash64WithSeed(Placement, FCStringAnsi::Strlen(Placement), Hash + 1);
+    Hash = CityHash64WithSeed(Fields, FieldsLength, Hash + 1);
+    // 0 marks a free slot
+    return Hash != 0 ? Hash : 1;
+}
+
+FGAAdEventDeduplicator::FEntry* FGAAdEventDeduplicator::FindSlot(uint64 KeyHash)
+{
+    const int32 Mask = Capacity - 1;
+    const int32 Home = (int32)(KeyHash & Mask);
+
+    for (int32 Probe = 0; Probe < Capacity; ++Probe)
+    {
+        FEntry& Entry = Entries[(Home + Probe) & Mask];
+        if (Entry.KeyHash == KeyHash || Entry.KeyHash == 0)
+        {
+            return &Entry;
+        }
+    }
+    return nullptr;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/Function.h"
+
+#include <atomic>
+
+/**
+ * Coalesces the bursts of identical ad events that mediation SDKs report.
+ * Only exact duplicates are coalesced. The first event of a key is held for the window and counts the duplicates that arrive meanwhile, then it is
+ * submitted once with the count. Keys are 64-bit hashes in a small open addressing table, when it is full events
+ * bypass the window and are submitted directly.
+ */
+class FGAAdEventDeduplicator
+{
+public:
+    /** Submits a held event, Count is the number of events it stands for */
+    typedef TUniqueFunction<void(int32 Count)> FSubmitFunction;
+
+    /** Window in seconds, 0 submits every held event and disables deduplication */
+    void SetWindow(double Seconds);
+
+    bool IsEnabled() const
+    {
+        return bIsEnabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Holds a new event or counts a duplicate of a held one. MakeSubmit is only called for new events.
+     * @return false when the event was not taken and has to be submitted by the caller
+     */
+    bool Add(uint64 KeyHash, TFunctionRef<FSubmitFunction()> MakeSubmit);
+
+    /** Submits the held events whose window has passed, or all of them */
+    void Flush(bool bExpiredOnly);
+
+    /** Only events equal in every parameter and in their serialized custom fields share a key */
+    static uint64 HashKey(uint8 Kind, uint8 Action, uint8 AdType, uint8 NoAdReason, int64 Duration, bool bMergeFields, const ANSICHAR* AdSdkName, const ANSICHAR* AdPlacement, const ANSICHAR* Fields, int32 FieldsLength);
+
+private:
+    struct FEntry
+    {
+        uint64 KeyHash = 0;
+        double FirstSeen = 0.0;
+        int32 Count = 0;
+        FSubmitFunction Submit;
+    };
+
+    static constexpr int32 Capacity = 64;
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    /** Slot of the key or the free slot it goes to, nullptr when the table is full */
+    FEntry* FindSlot(uint64 KeyHash);
+
+    std::atomic<bool> bIsEnabled{ false };
+    FCriticalSection Lock;
+    TArray<FEntry> Entries;
+    int32 NumEntries = 0;
+    double Window = 0.0;
+};
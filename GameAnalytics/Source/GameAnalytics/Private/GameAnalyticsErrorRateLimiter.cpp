@@ -0,0 +1,161 @@
+#include "GameAnalyticsErrorRateLimiter.h"
+#include "Hash/CityHash.h"
+#include "Misc/ScopeLock.h"
+#include "HAL/PlatformTime.h"
+
+FGAErrorRateLimiter::FGAErrorRateLimiter()
+{
+    LastSummary = FPlatformTime::Seconds();
+}
+
+void FGAErrorRateLimiter::SetLimit(EGAErrorSeverity Severity, const FGAErrorRateLimit& Limit)
+{
+    FScopeLock ScopeLock(&Lock);
+    Limits[(int32)Severity] = Limit;
+}
+
+bool FGAErrorRateLimiter::Allow(EGAErrorSeverity Severity, const ANSICHAR* Message)
+{
+    const int32 SeverityIndex = FMath::Clamp((int32)Severity, 0, (int32)EGAErrorSeverity::critical);
+    const uint64 ErrorFingerprint = Fingerprint(Severity, Message);
+    const double Now = FPlatformTime::Seconds();
+
+    FScopeLock ScopeLock(&Lock);
+
+    const FGAErrorRateLimit& Limit = Limits[SeverityIndex];
+    if (Limit.Burst <= 0)
+    {
+        return true;
+    }
+
+    if (Entries.Num() == 0)
+    {
+        Entries.SetNum(Capacity);
+    }
+
+    bool bIsNew = false;
+    FEntry& Entry = FindEntry(ErrorFingerprint, bIsNew);
+    if (bIsNew)
+    {
+        Entry.Tokens = (float)Limit.Burst;
+    }
+    else
+    {
+        const double Refill = (Now - Entry.LastRefill) * Limit.PerMinute / 60.0;
+        Entry.Tokens = FMath::Min((float)(Entry.Tokens + Refill), (float)Limit.Burst);
+    }
+    Entry.LastRefill = Now;
+
+    if (Entry.Tokens >= 1.0f)
+    {
+        Entry.Tokens -= 1.0f;
+        return true;
+    }
+
+    if (Entry.Suppressed++ == 0)
+    {
+        Pending.NumFingerprints++;
+    }
+    Pending.NumSuppressed++;
+    Pending.NumSuppressedBySeverity[SeverityIndex]++;
+    return false;
+}
+
+bool FGAErrorRateLimiter::ConsumeSummary(FSummary& OutSummary)
+{
+    const double Now = FPlatformTime::Seconds();
+
+    FScopeLock ScopeLock(&Lock);
+    if (Pending.NumSuppressed == 0 || Now - LastSummary < SummaryInterval)
+    {
+        return false;
+    }
+
+    OutSummary = Pending;
+    Pending = FSummary();
+    LastSummary = Now;
+
+    for (FEntry& Entry : Entries)
+    {
+        Entry.Suppressed = 0;
+    }
+    return true;
+}
+
+static bool IsWordChar(ANSICHAR c)
+{
+    return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+uint64 FGAErrorRateLimiter::Fingerprint(EGAErrorSeverity Severity, const ANSICHAR* Message)
+{
+    // ids, counters and addresses vary between repeats of the same error
+    TArray<ANSICHAR, TInlineAllocator<256>> Normalized;
+    const ANSICHAR* Start = Message != nullptr ? Message : "";
+    for (const ANSICHAR* c = Start; *c != '\0'; ++c)
+    {
+        if (c == Start || !IsWordChar(c[-1]))
+        {
+            int32 HexLength = 0;
+            while (FCharAnsi::IsHexDigit(c[HexLength]))
+            {
+                ++HexLength;
+            }
+            if (HexLength >= MinHexRunLength && !IsWordChar(c[HexLength]))
+            {
+                Normalized.Add('#');
+                c += HexLength - 1;
+                continue;
+            }
+        }
+
+        if (*c >= '0' && *c <= '9')
+        {
+            Normalized.Add('#');
+            while (FCharAnsi::IsHexDigit(c[1]) || c[1] == 'x' || c[1] == 'X')
+            {
+                ++c;
+            }
+            continue;
+        }
+        Normalized.Add(*c);
+    }
+
+    const uint64 Hash = CityHash64WithSeed(Normalized.GetData(), Normalized.Num(), (uint64)Severity);
+    // 0 marks a free slot
+    return Hash != 0 ? Hash : 1;
+}
+
+FGAErrorRateLimiter::FEntry& FGAErrorRateLimiter::FindEntry(uint64 ErrorFingerprint, bool& bOutIsNew)
+{
+    const int32 Mask = Capacity - 1;
+    const int32 Home = (int32)(ErrorFingerprint & Mask);
+
+    bOutIsNew = true;
+    FEntry* Stalest = nullptr;
+    for (int32 Probe = 0; Probe < MaxProbe; ++Probe)
+    {
+        FEntry& Entry = Entries[(Home + Probe) & Mask];
+        if (Entry.Fingerprint == ErrorFingerprint)
+        {
+            bOutIsNew = false;
+            return Entry;
+        }
+
+        if (Entry.Fingerprint == 0)
+        {
+            Entry.Fingerprint = ErrorFingerprint;
+            return Entry;
+        }
+
+        if (Stalest == nullptr || Entry.LastRefill < Stalest->LastRefill)
+        {
+            Stalest = &Entry;
+        }
+    }
+
+    // the evicted error starts over with a full bucket, its pending count stays in the summary
+    *Stalest = FEntry();
+    Stalest->Fingerprint = ErrorFingerprint;
+    return *Stalest;
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "GameAnalytics.h"
+
+/**
+ * Token bucket per error fingerprint, so one error repeated in a loop cannot flood the backend.
+ * A fingerprint is a 64-bit hash of the severity and the message with its numbers masked out, kept in a fixed size
+ * open addressing table. Suppressed errors are counted and handed out as a summary once per interval.
+ */
+class FGAErrorRateLimiter
+{
+public:
+    /** Errors suppressed since the last summary */
+    struct FSummary
+    {
+        int32 NumSuppressed = 0;
+        int32 NumFingerprints = 0;
+        int32 NumSuppressedBySeverity[(int32)EGAErrorSeverity::critical + 1] = {};
+    };
+
+    static constexpr double SummaryInterval = 60.0;
+
+    FGAErrorRateLimiter();
+
+    void SetLimit(EGAErrorSeverity Severity, const FGAErrorRateLimit& Limit);
+
+    /** @return false when the error is over the budget of its fingerprint, it is then counted for the next summary */
+    bool Allow(EGAErrorSeverity Severity, const ANSICHAR* Message);
+
+    /** Hands out and resets the suppressed counts, at most once per SummaryInterval and only when errors were suppressed */
+    bool ConsumeSummary(FSummary& OutSummary);
+
+    /**
+     * Hash of the severity and the message. A run of hex digits that starts with a decimal digit counts as one character,
+     * so does a whole word of at least MinHexRunLength hex digits, which catches hashes and GUIDs that start with a letter.
+     */
+    static uint64 Fingerprint(EGAErrorSeverity Severity, const ANSICHAR* Message);
+
+private:
+    struct FEntry
+    {
+        uint64 Fingerprint = 0;
+        double LastRefill = 0.0;
+        float Tokens = 0.0f;
+        int32 Suppressed = 0;
+    };
+
+    static constexpr int32 Capacity = 1024;
+    static constexpr int32 MaxProbe = 16;
+    /** Shorter words made of hex digits only, "add" or "cafe", are kept as text */
+    static constexpr int32 MinHexRunLength = 8;
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    /** Slot of the fingerprint, a free or the stalest slot in the probe window when it is new */
+    FEntry& FindEntry(uint64 Fingerprint, bool& bOutIsNew);
+
+    FCriticalSection Lock;
+    TArray<FEntry> Entries;
+    FGAErrorRateLimit Limits[(int32)EGAErrorSeverity::critical + 1];
+    FSummary Pending;
+    double LastSummary = 0.0;
+};
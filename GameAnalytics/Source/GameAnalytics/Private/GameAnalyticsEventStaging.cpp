@@ -0,0 +1,206 @@
+#include "GameAnalyticsEventStaging.h"
+#include "GameAnalytics.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+#include "Algo/StableSort.h"
+
+std::atomic<bool> FGameAnalyticsEventStaging::bEnabled(false);
+std::atomic<bool> FGameAnalyticsEventStaging::bHeld(false);
+thread_local bool FGameAnalyticsEventStaging::bIsFlushingThread = false;
+
+void FGameAnalyticsEventStaging::SetEnabled(bool bInEnabled)
+{
+    const bool bWasEnabled = bEnabled.exchange(bInEnabled);
+    if (bWasEnabled && !bInEnabled)
+    {
+        // submit whatever is still staged so disabling never drops events
+        sharedInstance()->Flush();
+    }
+}
+
+void FGameAnalyticsEventStaging::SetHeld(bool bInHeld)
+{
+    bHeld.store(bInHeld);
+}
+
+void FGameAnalyticsEventStaging::Release()
+{
+    FGameAnalyticsEventStaging* Staging = sharedInstance();
+    FScopeLock Lock(&Staging->FlushLock);
+    if (!bHeld.load())
+    {
+        return;
+    }
+
+    // drained while still held, so events raised meanwhile are staged behind the held ones instead of overtaking them
+    Staging->Collect();
+    bHeld.store(false);
+    // whatever was staged between the drain and the release
+    Staging->Collect();
+}
+
+void FGameAnalyticsEventStaging::Enqueue(FSubmitFunction&& Submit)
+{
+    Enqueue(MoveTemp(Submit), FPlatformTime::Cycles64());
+}
+
+void FGameAnalyticsEventStaging::Enqueue(FSubmitFunction&& Submit, uint64 Timestamp)
+{
+    FThreadBuffer* Buffer = GetThreadBuffer();
+    if (FStagedEvent* Slot = Buffer->ClaimSlot())
+    {
+        Slot->Timestamp = Timestamp;
+        Slot->SubmitPayload = nullptr;
+        Slot->SubmitFunction = MoveTemp(Submit);
+        Buffer->PublishSlot();
+        return;
+    }
+
+    FStagedEvent Event;
+    Event.Timestamp = Timestamp;
+    Event.SubmitFunction = MoveTemp(Submit);
+    Buffer->EnqueueOverflow(MoveTemp(Event));
+}
+
+void FGameAnalyticsEventStaging::Enqueue(FSubmitPayloadFunction Submit, FWritePayloadFunction WritePayload)
+{
+    const uint64 Timestamp = FPlatformTime::Cycles64();
+    FThreadBuffer* Buffer = GetThreadBuffer();
+    if (FStagedEvent* Slot = Buffer->ClaimSlot())
+    {
+        Slot->Timestamp = Timestamp;
+        Slot->SubmitPayload = Submit;
+        // keeps the allocation of the previous payload
+        Slot->Payload.Reset();
+        WritePayload(Slot->Payload);
+        Buffer->PublishSlot();
+        return;
+    }
+
+    FStagedEvent Event;
+    Event.Timestamp = Timestamp;
+    Event.SubmitPayload = Submit;
+    WritePayload(Event.Payload);
+    Buffer->EnqueueOverflow(MoveTemp(Event));
+}
+
+FGameAnalyticsEventStaging::FThreadBuffer* FGameAnalyticsEventStaging::GetThreadBuffer()
+{
+    // buffers are never freed while the process is alive, the lease hands this one back when the thread exits
+    static thread_local FThreadBufferLease Lease;
+    if (Lease.Buffer == nullptr)
+    {
+        Lease.Buffer = sharedInstance()->AcquireThreadBuffer();
+    }
+    return Lease.Buffer;
+}
+
+FGameAnalyticsEventStaging::FThreadBuffer* FGameAnalyticsEventStaging::AcquireThreadBuffer()
+{
+    FScopeLock Lock(&BuffersLock);
+    for (const TUniquePtr<FThreadBuffer>& Buffer : Buffers)
+    {
+        // acquire pairs with the release of the exited producer, its last enqueue is visible to the new one
+        bool bExpected = false;
+        if (Buffer->bInUse.compare_exchange_strong(bExpected, true, std::memory_order_acquire))
+        {
+            return Buffer.Get();
+        }
+    }
+    return Buffers.Add_GetRef(MakeUnique<FThreadBuffer>()).Get();
+}
+
+void FGameAnalyticsEventStaging::Flush()
+{
+    if (bIsFlushingThread)
+    {
+        // a staged event asked for a flush (e.g. endSession), the outer collection is already draining
+        return;
+    }
+
+    if (bHeld.load())
+    {
+        // the backend is not initialized yet, keep everything staged
+        return;
+    }
+
+    FScopeLock Lock(&FlushLock);
+    Collect();
+}
+
+void FGameAnalyticsEventStaging::Collect()
+{
+    struct FCollectedBuffer
+    {
+        FThreadBuffer* Buffer;
+        uint32 Tail;
+        uint32 Head;
+        int32 FirstOverflow;
+        int32 NumOverflow;
+    };
+
+    TArray<FCollectedBuffer, TInlineAllocator<16>> Collected;
+    {
+        FScopeLock RegistrationLock(&BuffersLock);
+        for (const TUniquePtr<FThreadBuffer>& Buffer : Buffers)
+        {
+            Collected.Add(FCollectedBuffer{ Buffer.Get(), 0, 0, 0, 0 });
+        }
+    }
+
+    FStagedEvent Event;
+    for (FCollectedBuffer& Entry : Collected)
+    {
+        // the ring before the overflow queue, a producer only goes back to its ring once the queue is empty,
+        // so whatever it adds to the ring from now on is newer than anything taken from the queue below
+        Entry.Tail = Entry.Buffer->Tail.load(std::memory_order_relaxed);
+        Entry.Head = Entry.Buffer->Head.load(std::memory_order_acquire);
+        Entry.FirstOverflow = OverflowEvents.Num();
+        while (Entry.Buffer->Overflow.Dequeue(Event))
+        {
+            OverflowEvents.Add(MoveTemp(Event));
+            Entry.Buffer->NumOverflow.fetch_sub(1, std::memory_order_acq_rel);
+        }
+        Entry.NumOverflow = OverflowEvents.Num() - Entry.FirstOverflow;
+    }
+
+    // OverflowEvents no longer grows, pointers into it stay valid
+    for (const FCollectedBuffer& Entry : Collected)
+    {
+        for (uint32 Index = Entry.Tail; Index != Entry.Head; ++Index)
+        {
+            MergedEvents.Add(&Entry.Buffer->Ring[Index & (FThreadBuffer::RingCapacity - 1)]);
+        }
+        for (int32 Index = 0; Index < Entry.NumOverflow; ++Index)
+        {
+            MergedEvents.Add(&OverflowEvents[Entry.FirstOverflow + Index]);
+        }
+    }
+
+    if (MergedEvents.Num() > 0)
+    {
+        // each buffer is already ordered, a stable sort keeps per-thread order for identical timestamps
+        Algo::StableSort(MergedEvents, [](const FStagedEvent* A, const FStagedEvent* B)
+        {
+            return A->Timestamp < B->Timestamp;
+        });
+
+        TGuardValue<bool> FlushingGuard(bIsFlushingThread, true);
+        for (FStagedEvent* Staged : MergedEvents)
+        {
+            Staged->Submit();
+            // releases the captured state now, the payload storage stays with the slot
+            Staged->SubmitFunction = nullptr;
+        }
+    }
+
+    // the submitted slots go back to their producers
+    for (const FCollectedBuffer& Entry : Collected)
+    {
+        Entry.Buffer->Tail.store(Entry.Head, std::memory_order_release);
+    }
+
+    // keep the capacity around for the next collection
+    MergedEvents.Reset();
+    OverflowEvents.Reset();
+}
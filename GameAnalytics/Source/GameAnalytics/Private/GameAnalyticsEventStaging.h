@@ -0,0 +1,201 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "Templates/Function.h"
+#include "Templates/UniquePtr.h"
+#include "HAL/CriticalSection.h"
+#include "Foundation/GASingleton.h"
+
+#include <atomic>
+#include <string>
+
+/**
+ * Owning copy of a backend string argument.
+ * Keeps the difference between NULL and "" intact, the iOS backend relies on it for optional progression parts.
+ */
+struct FGAStagedString
+{
+    FGAStagedString()
+        : bIsNull(true)
+    {
+    }
+
+    FGAStagedString(const char* InValue)
+        : Value(InValue != nullptr ? InValue : "")
+        , bIsNull(InValue == nullptr)
+    {
+    }
+
+    const char* Get() const
+    {
+        return bIsNull ? nullptr : Value.c_str();
+    }
+
+    std::string Value;
+    bool bIsNull;
+};
+
+/**
+ * Per-thread staging buffers for outgoing events.
+ *
+ * Every producing thread gets its own single-producer ring of preallocated slots, registered on first use through
+ * thread-local storage. Enqueueing takes no lock and never writes to a cache line shared with another producer.
+ * A slot keeps its payload storage between events, so staging a payload no larger than one the slot held before does
+ * not allocate. When the ring is full the event goes to a node queue instead, and so does everything after it until
+ * the collector has drained that queue. The buffer of a thread that exits is handed to the next thread that
+ * registers, so short lived worker threads do not grow the buffer list.
+ * The collector drains all buffers, merges the staged events by timestamp and submits them to the backend
+ * in the order they were raised.
+ */
+class FGameAnalyticsEventStaging : public GASingleton<FGameAnalyticsEventStaging>
+{
+public:
+    typedef TUniqueFunction<void()> FSubmitFunction;
+
+    /** Rebuilds and submits an event from the bytes it was staged with */
+    typedef void (*FSubmitPayloadFunction)(const uint8* Payload, int32 Size);
+
+    /** Appends the payload of an event to the slot's storage */
+    typedef TFunctionRef<void(TArray<uint8>& Payload)> FWritePayloadFunction;
+
+    /** False on the collecting thread while it flushes, so staged work that raises further events submits them directly. */
+    static bool IsEnabled()
+    {
+        return (bEnabled.load(std::memory_order_relaxed) || bHeld.load(std::memory_order_relaxed)) && !bIsFlushingThread;
+    }
+
+    static void SetEnabled(bool bInEnabled);
+
+    /**
+     * While held every event is staged, even with staging disabled, and flushing does nothing.
+     * Used to keep events back until a deferred backend initialization has completed.
+     */
+    static void SetHeld(bool bInHeld);
+
+    /**
+     * Submits the held events and lifts the hold in one step, nothing raised on the calling thread can overtake them.
+     * Events another thread raises while the hold is lifted may be submitted after the next flush.
+     */
+    static void Release();
+
+    /** Stages an event on the calling thread's buffer. */
+    static void Enqueue(FSubmitFunction&& Submit);
+
+    /** Stages an event prepared off the raising thread, Timestamp is the FPlatformTime::Cycles64() of when it was raised. */
+    static void Enqueue(FSubmitFunction&& Submit, uint64 Timestamp);
+
+    /**
+     * Stages an event as a plain function and a flat copy of its data, written straight into the ring slot.
+     * Unlike a submit function nothing is captured, a warm thread stages these without allocating.
+     */
+    static void Enqueue(FSubmitPayloadFunction Submit, FWritePayloadFunction WritePayload);
+
+    /** Drains every thread buffer and submits the staged events in timestamp order. */
+    void Flush();
+
+private:
+    struct FStagedEvent
+    {
+        void Submit() const
+        {
+            if (SubmitPayload != nullptr)
+            {
+                SubmitPayload(Payload.GetData(), Payload.Num());
+            }
+            else
+            {
+                SubmitFunction();
+            }
+        }
+
+        uint64 Timestamp = 0;
+        /** Set for payload events, SubmitFunction is used otherwise */
+        FSubmitPayloadFunction SubmitPayload = nullptr;
+        TArray<uint8> Payload;
+        FSubmitFunction SubmitFunction;
+    };
+
+    struct alignas(PLATFORM_CACHE_LINE_SIZE) FThreadBuffer
+    {
+        /** Events one thread raises between two flushes in a typical frame, a power of two */
+        static constexpr uint32 RingCapacity = 256;
+
+        /** Slot for the next event, nullptr when the ring is full or older events still wait in the overflow queue */
+        FStagedEvent* ClaimSlot()
+        {
+            if (NumOverflow.load(std::memory_order_acquire) > 0)
+            {
+                return nullptr;
+            }
+
+            // acquire pairs with the collector releasing the slots it has submitted
+            const uint32 CurrentHead = Head.load(std::memory_order_relaxed);
+            if (CurrentHead - Tail.load(std::memory_order_acquire) == RingCapacity)
+            {
+                return nullptr;
+            }
+            return &Ring[CurrentHead & (RingCapacity - 1)];
+        }
+
+        /** Hands the claimed slot to the collector */
+        void PublishSlot()
+        {
+            Head.store(Head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+
+        void EnqueueOverflow(FStagedEvent&& Event)
+        {
+            // counted before it is queued, so the count only reaches zero once the collector has taken everything
+            NumOverflow.fetch_add(1, std::memory_order_acq_rel);
+            Overflow.Enqueue(MoveTemp(Event));
+        }
+
+        FStagedEvent Ring[RingCapacity];
+        /** Next slot to write, only the owning thread advances it */
+        std::atomic<uint32> Head{ 0 };
+        /** Next slot to submit, only the collector advances it */
+        std::atomic<uint32> Tail{ 0 };
+        TQueue<FStagedEvent, EQueueMode::Spsc> Overflow;
+        std::atomic<int32> NumOverflow{ 0 };
+        /** Owned by a live thread, events it left behind stay queued for the next owner */
+        std::atomic<bool> bInUse{ true };
+    };
+
+    /** Returns the buffer of the calling thread to the pool when the thread exits */
+    struct FThreadBufferLease
+    {
+        ~FThreadBufferLease()
+        {
+            if (Buffer != nullptr)
+            {
+                Buffer->bInUse.store(false, std::memory_order_release);
+            }
+        }
+
+        FThreadBuffer* Buffer = nullptr;
+    };
+
+    /** Drains and submits the staged events, the caller holds FlushLock */
+    void Collect();
+
+    /** Buffer of the calling thread, acquired on first use */
+    static FThreadBuffer* GetThreadBuffer();
+
+    /** Reuses the buffer of an exited thread or registers a new one */
+    FThreadBuffer* AcquireThreadBuffer();
+
+    /** Guards registration of new thread buffers */
+    FCriticalSection BuffersLock;
+    TArray<TUniquePtr<FThreadBuffer>> Buffers;
+
+    /** Only one collector may consume the single-consumer queues at a time */
+    FCriticalSection FlushLock;
+    /** Ring slots stay in place until submitted, only the overflow events are moved out */
+    TArray<FStagedEvent*> MergedEvents;
+    TArray<FStagedEvent> OverflowEvents;
+
+    static std::atomic<bool> bEnabled;
+    static std::atomic<bool> bHeld;
+    static thread_local bool bIsFlushingThread;
+};
@@ -0,0 +1,58 @@
+#include "GameAnalyticsFrameTimeTracker.h"
+#include "Misc/CoreDelegates.h"
+#include "HAL/PlatformTime.h"
+#include "Async/Async.h"
+
+void FGAFrameTimeTracker::SetEnabled(bool bEnabled)
+{
+    if (!IsInGameThread())
+    {
+        // the delegate and LastFrameTime belong to the game thread, the tracker outlives the task as a static
+        AsyncTask(ENamedThreads::GameThread, [this, bEnabled]()
+        {
+            SetEnabled(bEnabled);
+        });
+        return;
+    }
+
+    if (bEnabled && !EndFrameHandle.IsValid())
+    {
+        LastFrameTime = FPlatformTime::Seconds();
+        EndFrameHandle = FCoreDelegates::OnEndFrame.AddRaw(this, &FGAFrameTimeTracker::OnEndFrame);
+    }
+    else if (!bEnabled && EndFrameHandle.IsValid())
+    {
+        FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+        EndFrameHandle.Reset();
+    }
+}
+
+float FGAFrameTimeTracker::Sample()
+{
+    // frames of a bucket last 1 / fps each, so the mean over the interval is the harmonic mean of the buckets
+    uint64 NumFrames = 0;
+    double Seconds = 0.0;
+    for (int32 Fps = 1; Fps <= MaxFps; ++Fps)
+    {
+        const uint32 Count = Buckets[Fps - 1].exchange(0, std::memory_order_relaxed);
+        NumFrames += Count;
+        Seconds += (double)Count / Fps;
+    }
+
+    if (Seconds > 0.0)
+    {
+        LastMean.store((float)(NumFrames / Seconds), std::memory_order_relaxed);
+    }
+    return LastMean.load(std::memory_order_relaxed);
+}
+
+void FGAFrameTimeTracker::OnEndFrame()
+{
+    const double Now = FPlatformTime::Seconds();
+    const double FrameTime = Now - LastFrameTime;
+    LastFrameTime = Now;
+
+    // frames of a second or more, hitches and loading screens, count as 1 fps
+    const int32 Fps = FrameTime > 0.0 ? FMath::Clamp(FMath::RoundToInt(1.0 / FrameTime), 1, MaxFps) : MaxFps;
+    Buckets[Fps - 1].fetch_add(1, std::memory_order_relaxed);
+}
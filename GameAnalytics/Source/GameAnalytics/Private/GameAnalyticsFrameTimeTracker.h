@@ -0,0 +1,33 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Delegates/IDelegateInstance.h"
+
+#include <atomic>
+
+/**
+ * Frame rate source for the health event of the C++ SDK.
+ * Every frame end adds one count to a fixed bucket histogram of frame rates, a relaxed atomic increment and nothing else.
+ * The SDK samples it from its own thread, which drains the histogram and gets the mean frame rate since the last sample.
+ */
+class FGAFrameTimeTracker
+{
+public:
+    /** Hooks into FCoreDelegates::OnEndFrame, called off the game thread it is applied there on the next tick */
+    void SetEnabled(bool bEnabled);
+
+    /** Mean frames per second since the last sample, the previous mean when no frame ended meanwhile. Safe on any thread */
+    float Sample();
+
+private:
+    /** One bucket per whole frame rate from 1 to MaxFps, faster frames count as MaxFps */
+    static constexpr int32 MaxFps = 240;
+
+    void OnEndFrame();
+
+    std::atomic<uint32> Buckets[MaxFps] = {};
+    /** Reported again while no frame ends, a loading hitch must not read as 0 fps */
+    std::atomic<float> LastMean{ 0.0f };
+    double LastFrameTime = 0.0;
+    FDelegateHandle EndFrameHandle;
+};
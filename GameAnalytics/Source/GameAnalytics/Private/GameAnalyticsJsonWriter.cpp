@@ -0,0 +1,285 @@
+#include "GameAnalyticsJsonWriter.h"
+#include "Runtime/Launch/Resources/Version.h"
+
+#include <cstdio>
+
+namespace
+{
+    // buffers that grew past this are released on Reset instead of being kept by the thread forever
+    const int32 MaxRetainedCapacity = 64 * 1024;
+}
+
+FGAJsonWriter& FGAJsonWriter::Get()
+{
+    static thread_local FGAJsonWriter Writer;
+    return Writer;
+}
+
+void FGAJsonWriter::Reset()
+{
+    if (Buffer.Max() > MaxRetainedCapacity)
+    {
+        Buffer.Empty();
+    }
+    else
+    {
+        Buffer.Reset();
+    }
+    HasElements.Reset();
+}
+
+void FGAJsonWriter::BeginObject()
+{
+    WriteSeparator();
+    Append('{');
+    HasElements.Add(false);
+}
+
+void FGAJsonWriter::EndObject()
+{
+    Append('}');
+    HasElements.Pop();
+}
+
+void FGAJsonWriter::WriteMembers(const FJsonObject& Object)
+{
+    for (const auto& Member : Object.Values)
+    {
+        if (Member.Value.IsValid())
+        {
+            WriteMember(Member.Key, *Member.Value);
+        }
+    }
+}
+
+void FGAJsonWriter::WriteMember(const FString& Key, const FJsonValue& Value)
+{
+    WriteSeparator();
+    WriteString(*Key, Key.Len());
+    Append(':');
+    WriteValue(Value);
+}
+
+void FGAJsonWriter::WriteStringMember(const FString& Key, const TCHAR* Value, int32 Length)
+{
+    WriteSeparator();
+    WriteString(*Key, Key.Len());
+    Append(':');
+    WriteString(Value, Length);
+}
+
+void FGAJsonWriter::WriteNumberMember(const TCHAR* Key, double Value)
+{
+    WriteSeparator();
+    WriteString(Key, FCString::Strlen(Key));
+    Append(':');
+    WriteNumber(Value);
+}
+
+void FGAJsonWriter::WriteRawMember(const TArray<ANSICHAR>& Member)
+{
+    WriteSeparator();
+    Append(Member.GetData(), Member.Num());
+}
+
+FGAJsonWriter::FMark FGAJsonWriter::GetMark() const
+{
+    FMark Mark;
+    Mark.Length = Buffer.Num();
+    Mark.bHasElements = HasElements.Num() > 0 && HasElements.Last();
+    return Mark;
+}
+
+void FGAJsonWriter::Rollback(const FMark& Mark)
+{
+    check(Mark.Length <= Buffer.Num());
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4)
+    Buffer.SetNum(Mark.Length, EAllowShrinking::No);
+#else
+    Buffer.SetNum(Mark.Length, false);
+#endif
+    if (HasElements.Num() > 0)
+    {
+        HasElements.Last() = Mark.bHasElements;
+    }
+}
+
+const ANSICHAR* FGAJsonWriter::GetData()
+{
+    // terminate in the slack, the terminator is not part of the content
+    Buffer.Reserve(Buffer.Num() + 1);
+    Buffer.GetData()[Buffer.Num()] = '\0';
+    return Buffer.GetData();
+}
+
+void FGAJsonWriter::WriteSeparator()
+{
+    if (HasElements.Num() == 0)
+    {
+        return;
+    }
+
+    bool& bHasElements = HasElements.Last();
+    if (bHasElements)
+    {
+        Append(',');
+    }
+    bHasElements = true;
+}
+
+void FGAJsonWriter::WriteValue(const FJsonValue& Value)
+{
+    switch (Value.Type)
+    {
+    case EJson::String:
+    {
+        // a copy, FJsonValue has no accessor for its string by reference
+        const FString String = Value.AsString();
+        WriteString(*String, String.Len());
+        break;
+    }
+    case EJson::Number:
+        WriteNumber(Value.AsNumber());
+        break;
+    case EJson::Boolean:
+        if (Value.AsBool())
+        {
+            Append("true", 4);
+        }
+        else
+        {
+            Append("false", 5);
+        }
+        break;
+    case EJson::Array:
+    {
+        Append('[');
+        HasElements.Add(false);
+        for (const TSharedPtr<FJsonValue>& Element : Value.AsArray())
+        {
+            if (Element.IsValid())
+            {
+                WriteSeparator();
+                WriteValue(*Element);
+            }
+        }
+        HasElements.Pop();
+        Append(']');
+        break;
+    }
+    case EJson::Object:
+    {
+        const TSharedPtr<FJsonObject>& Object = Value.AsObject();
+        Append('{');
+        HasElements.Add(false);
+        if (Object.IsValid())
+        {
+            WriteMembers(*Object);
+        }
+        HasElements.Pop();
+        Append('}');
+        break;
+    }
+    default:
+        Append("null", 4);
+        break;
+    }
+}
+
+void FGAJsonWriter::WriteString(const TCHAR* Chars, int32 Length)
+{
+    static const ANSICHAR HexDigits[] = "0123456789abcdef";
+
+    Append('"');
+
+    for (int32 i = 0; i < Length; ++i)
+    {
+        uint32 CodePoint = (uint32)Chars[i];
+
+        switch (CodePoint)
+        {
+        case '"': Append("\\\"", 2); continue;
+        case '\\': Append("\\\\", 2); continue;
+        case '\b': Append("\\b", 2); continue;
+        case '\f': Append("\\f", 2); continue;
+        case '\n': Append("\\n", 2); continue;
+        case '\r': Append("\\r", 2); continue;
+        case '\t': Append("\\t", 2); continue;
+        default: break;
+        }
+
+        if (CodePoint < 0x20)
+        {
+            const ANSICHAR Escaped[] = { '\\', 'u', '0', '0', HexDigits[CodePoint >> 4], HexDigits[CodePoint & 0xF] };
+            Append(Escaped, 6);
+            continue;
+        }
+
+        if (CodePoint < 0x80)
+        {
+            Append((ANSICHAR)CodePoint);
+            continue;
+        }
+
+        // combine UTF-16 surrogate pairs, lone surrogates become U+FFFD
+        if (CodePoint >= 0xD800 && CodePoint <= 0xDFFF)
+        {
+            const uint32 Low = (i + 1 < Length) ? (uint32)Chars[i + 1] : 0;
+            if (CodePoint <= 0xDBFF && Low >= 0xDC00 && Low <= 0xDFFF)
+            {
+                CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (Low - 0xDC00);
+                ++i;
+            }
+            else
+            {
+                CodePoint = 0xFFFD;
+            }
+        }
+
+        if (CodePoint < 0x800)
+        {
+            const ANSICHAR Encoded[] = { (ANSICHAR)(0xC0 | (CodePoint >> 6)), (ANSICHAR)(0x80 | (CodePoint & 0x3F)) };
+            Append(Encoded, 2);
+        }
+        else if (CodePoint < 0x10000)
+        {
+            const ANSICHAR Encoded[] = { (ANSICHAR)(0xE0 | (CodePoint >> 12)), (ANSICHAR)(0x80 | ((CodePoint >> 6) & 0x3F)), (ANSICHAR)(0x80 | (CodePoint & 0x3F)) };
+            Append(Encoded, 3);
+        }
+        else
+        {
+            const ANSICHAR Encoded[] = { (ANSICHAR)(0xF0 | (CodePoint >> 18)), (ANSICHAR)(0x80 | ((CodePoint >> 12) & 0x3F)), (ANSICHAR)(0x80 | ((CodePoint >> 6) & 0x3F)), (ANSICHAR)(0x80 | (CodePoint & 0x3F)) };
+            Append(Encoded, 4);
+        }
+    }
+
+    Append('"');
+}
+
+void FGAJsonWriter::WriteNumber(double Value)
+{
+    ANSICHAR Formatted[32];
+    int32 Length;
+
+    if (!FMath::IsFinite(Value))
+    {
+        // not representable in JSON
+        Formatted[0] = '0';
+        Length = 1;
+    }
+    else if (Value == FMath::FloorToDouble(Value) && FMath::Abs(Value) < 9007199254740992.0)
+    {
+        Length = snprintf(Formatted, sizeof(Formatted), "%lld", (long long)Value);
+    }
+    else
+    {
+        Length = snprintf(Formatted, sizeof(Formatted), "%.17g", Value);
+    }
+
+    Append(Formatted, FMath::Clamp(Length, 0, (int32)sizeof(Formatted) - 1));
+}
+
+void FGAJsonWriter::Append(const ANSICHAR* Data, int32 Length)
+{
+    Buffer.Append(Data, Length);
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+/**
+ * Condensed JSON writer that encodes straight into a UTF-8 buffer.
+ * Every thread owns one instance through Get(), Reset() keeps the capacity of the buffer, so the output side does not
+ * allocate once the buffer has grown to the usual payload size. String values of an FJsonValue are still copied once
+ * each, FJsonValue only hands its string out by value.
+ */
+class FGAJsonWriter
+{
+public:
+    /** Writer of the calling thread, the result stays valid until the next Reset on this thread */
+    static FGAJsonWriter& Get();
+
+    /** Clears the content, keeps the capacity unless a huge payload inflated it */
+    void Reset();
+
+    void BeginObject();
+    void EndObject();
+
+    /** Writes all members of Object into the currently open object */
+    void WriteMembers(const FJsonObject& Object);
+    void WriteMember(const FString& Key, const FJsonValue& Value);
+    void WriteStringMember(const FString& Key, const TCHAR* Value, int32 Length);
+    void WriteNumberMember(const TCHAR* Key, double Value);
+
+    /** Appends an already serialized "key":value member into the currently open object */
+    void WriteRawMember(const TArray<ANSICHAR>& Member);
+
+    /** Position to roll back to when a member turns out not to fit */
+    struct FMark
+    {
+        int32 Length;
+        bool bHasElements;
+    };
+
+    FMark GetMark() const;
+    void Rollback(const FMark& Mark);
+
+    /** Null terminated content */
+    const ANSICHAR* GetData();
+    int32 Len() const { return Buffer.Num(); }
+
+private:
+    void WriteSeparator();
+    void WriteValue(const FJsonValue& Value);
+    void WriteString(const TCHAR* Chars, int32 Length);
+    void WriteNumber(double Value);
+
+    FORCEINLINE void Append(ANSICHAR Char)
+    {
+        Buffer.Add(Char);
+    }
+
+    void Append(const ANSICHAR* Data, int32 Length);
+
+    TArray<ANSICHAR> Buffer;
+    /** One entry per open object or array, true once it holds an element */
+    TArray<bool, TInlineAllocator<8> > HasElements;
+};
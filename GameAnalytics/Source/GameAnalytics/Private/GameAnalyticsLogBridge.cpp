@@ -0,0 +1,183 @@
+#include "GameAnalyticsLogBridge.h"
+#include "GameAnalytics.h"
+#include "HAL/Event.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/ScopeLock.h"
+#include "Containers/StringConv.h"
+
+FGALogBridge::~FGALogBridge()
+{
+    Shutdown();
+}
+
+void FGALogBridge::Configure(const TArray<FName>& InCategories, bool bInIncludeWarnings)
+{
+    FScopeLock ScopeLock(&ControlLock);
+
+    // the filter is read without a lock, it can only change while nothing is captured
+    Shutdown();
+    Categories = TSet<FName>(InCategories);
+    MaxVerbosity = bInIncludeWarnings ? ELogVerbosity::Warning : ELogVerbosity::Error;
+    if (bEnabled)
+    {
+        Start();
+    }
+}
+
+void FGALogBridge::SetEnabled(bool bInEnabled)
+{
+    FScopeLock ScopeLock(&ControlLock);
+
+    bEnabled = bInEnabled;
+    if (bEnabled)
+    {
+        Start();
+    }
+    else
+    {
+        Shutdown();
+    }
+}
+
+void FGALogBridge::Start()
+{
+    if (Thread != nullptr || GLog == nullptr)
+    {
+        return;
+    }
+
+    if (!FPlatformProcess::SupportsMultithreading())
+    {
+        UE_LOG(LogGameAnalyticsAnalytics, Warning, TEXT("The log bridge needs a background thread, it is not available on this platform"));
+        return;
+    }
+
+    if (!Slots.IsValid())
+    {
+        Slots = MakeUnique<FLineSlot[]>(MaxPending);
+        for (uint32 Index = 0; Index < MaxPending; ++Index)
+        {
+            Slots[Index].Sequence.store(Index, std::memory_order_relaxed);
+        }
+    }
+
+    bStopping.store(false, std::memory_order_relaxed);
+    WakeEvent = FPlatformProcess::GetSynchEventFromPool();
+    Thread = FRunnableThread::Create(this, TEXT("GameAnalyticsLogBridge"), 0, TPri_BelowNormal);
+    GLog->AddOutputDevice(this);
+}
+
+void FGALogBridge::Shutdown()
+{
+    if (Thread == nullptr)
+    {
+        return;
+    }
+
+    if (GLog != nullptr)
+    {
+        GLog->RemoveOutputDevice(this);
+    }
+
+    // Run drains what is left before it returns
+    Thread->Kill(true);
+    delete Thread;
+    Thread = nullptr;
+
+    FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+    WakeEvent = nullptr;
+}
+
+void FGALogBridge::Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category)
+{
+    static const FName OwnCategory = LogGameAnalyticsAnalytics.GetCategoryName();
+
+    const ELogVerbosity::Type LineVerbosity = (ELogVerbosity::Type)(Verbosity & ELogVerbosity::VerbosityMask);
+    if (LineVerbosity > MaxVerbosity || LineVerbosity == ELogVerbosity::NoLogging || Category == OwnCategory)
+    {
+        return;
+    }
+
+    if (!bErrorReporting.load(std::memory_order_relaxed) || (Categories.Num() > 0 && !Categories.Contains(Category)))
+    {
+        return;
+    }
+
+    // bounded, a flood of log lines must not grow the ring faster than the background thread drains it
+    uint32 Position = EnqueuePos.load(std::memory_order_relaxed);
+    FLineSlot* Slot;
+    for (;;)
+    {
+        Slot = &Slots[Position & (MaxPending - 1)];
+        const int32 Distance = (int32)(Slot->Sequence.load(std::memory_order_acquire) - Position);
+        if (Distance == 0)
+        {
+            if (EnqueuePos.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (Distance < 0)
+        {
+            // the slot still holds a line from one lap ago, the ring is full
+            return;
+        }
+        else
+        {
+            Position = EnqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    FCString::Strncpy(Slot->Message, V, MaxLineLength);
+    Slot->Category = Category;
+    Slot->Verbosity = LineVerbosity;
+    Slot->Sequence.store(Position + 1, std::memory_order_release);
+}
+
+uint32 FGALogBridge::Run()
+{
+    while (!bStopping.load(std::memory_order_relaxed))
+    {
+        WakeEvent->Wait(DrainIntervalMs);
+        Drain();
+    }
+    Drain();
+    return 0;
+}
+
+void FGALogBridge::Stop()
+{
+    bStopping.store(true, std::memory_order_relaxed);
+    WakeEvent->Trigger();
+}
+
+void FGALogBridge::Drain()
+{
+    for (;;)
+    {
+        FLineSlot& Slot = Slots[DequeuePos & (MaxPending - 1)];
+        if (Slot.Sequence.load(std::memory_order_acquire) != DequeuePos + 1)
+        {
+            return;
+        }
+
+        EGAErrorSeverity Severity = EGAErrorSeverity::warning;
+        if (Slot.Verbosity == ELogVerbosity::Fatal)
+        {
+            Severity = EGAErrorSeverity::critical;
+        }
+        else if (Slot.Verbosity == ELogVerbosity::Error)
+        {
+            Severity = EGAErrorSeverity::error;
+        }
+
+        // formatted before the slot is handed back, the event is raised without holding up producers
+        const FString Message = FString::Printf(TEXT("%s: %s"), *Slot.Category.ToString(), Slot.Message);
+        Slot.Sequence.store(DequeuePos + MaxPending, std::memory_order_release);
+        ++DequeuePos;
+
+        // the rate limiter of submitEvent fingerprints the message, repeats of a line are cut there
+        UGameAnalytics::addErrorEvent(Severity, TCHAR_TO_UTF8(*Message));
+    }
+}
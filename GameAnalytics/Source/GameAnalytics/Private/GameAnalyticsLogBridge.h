@@ -0,0 +1,85 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/UniquePtr.h"
+#include "HAL/Runnable.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/OutputDevice.h"
+
+#include <atomic>
+
+class FEvent;
+class FRunnableThread;
+
+/**
+ * Output device that turns UE_LOG errors and warnings into error events.
+ * The logging thread only filters the line and copies it into a slot of a fixed ring, allocated once when the bridge
+ * first starts. Lines are truncated to the slot size and dropped while the ring is full. A background thread drains
+ * the ring, formats the messages and raises the events, so fingerprinting and rate limiting never run on it.
+ * The plugin's own log category is never captured.
+ */
+class FGALogBridge : public FOutputDevice, public FRunnable
+{
+public:
+    virtual ~FGALogBridge();
+
+    /** Categories to capture, all when empty. Restarts the bridge when it is running */
+    void Configure(const TArray<FName>& InCategories, bool bInIncludeWarnings);
+
+    /** Registers with GLog and starts the background thread, or tears both down */
+    void SetEnabled(bool bEnabled);
+
+    /** Mirrors setEnabledErrorReporting, nothing is captured while it is off */
+    void SetErrorReportingEnabled(bool bEnabled)
+    {
+        bErrorReporting.store(bEnabled, std::memory_order_relaxed);
+    }
+
+    // FOutputDevice
+    virtual void Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category) override;
+    virtual bool CanBeUsedOnAnyThread() const override
+    {
+        return true;
+    }
+
+    // FRunnable
+    virtual uint32 Run() override;
+    virtual void Stop() override;
+
+private:
+    /** Lines waiting for the background thread, further lines are dropped. A power of two */
+    static constexpr uint32 MaxPending = 256;
+    /** Characters kept of a line, terminator included */
+    static constexpr int32 MaxLineLength = 512;
+    static constexpr uint32 DrainIntervalMs = 250;
+
+    struct FLineSlot
+    {
+        /** Equals the enqueue position once the slot is free for it, the position plus one once its line is written */
+        std::atomic<uint32> Sequence{ 0 };
+        FName Category;
+        ELogVerbosity::Type Verbosity = ELogVerbosity::NoLogging;
+        TCHAR Message[MaxLineLength];
+    };
+
+    void Start();
+    void Shutdown();
+    void Drain();
+
+    /** Bounded multi producer ring, producers claim positions from EnqueuePos, the background thread reads at DequeuePos */
+    TUniquePtr<FLineSlot[]> Slots;
+    std::atomic<uint32> EnqueuePos{ 0 };
+    uint32 DequeuePos = 0;
+    std::atomic<bool> bStopping{ false };
+    std::atomic<bool> bErrorReporting{ true };
+
+    /** Only changed while the device is not registered */
+    TSet<FName> Categories;
+    ELogVerbosity::Type MaxVerbosity = ELogVerbosity::Error;
+
+    /** Guards Configure and SetEnabled */
+    FCriticalSection ControlLock;
+    bool bEnabled = false;
+    FEvent* WakeEvent = nullptr;
+    FRunnableThread* Thread = nullptr;
+};
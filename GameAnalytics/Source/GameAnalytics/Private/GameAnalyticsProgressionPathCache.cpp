@@ -0,0 +1,75 @@
+#include "GameAnalyticsProgressionPathCache.h"
+#include "Misc/Crc.h"
+#include "Misc/ScopeLock.h"
+#include "Containers/StringConv.h"
+
+FGAProgressionPathCache::FPathRef FGAProgressionPathCache::Get(TConstArrayView<FString> Hierarchy)
+{
+    check(Hierarchy.Num() > 0);
+    const int32 NumParts = FMath::Min(Hierarchy.Num(), 3);
+
+    uint32 Hash = 0;
+    for (int32 i = 0; i < NumParts; ++i)
+    {
+        Hash = FCrc::StrCrc32(*Hierarchy[i], Hash);
+    }
+
+    {
+        FScopeLock ScopeLock(&Lock);
+        for (FEntry& Entry : Entries)
+        {
+            if (Entry.Hash != Hash || Entry.Hierarchy.Num() != NumParts)
+            {
+                continue;
+            }
+
+            bool bMatches = true;
+            for (int32 i = 0; i < NumParts && bMatches; ++i)
+            {
+                bMatches = Entry.Hierarchy[i].Equals(Hierarchy[i], ESearchCase::CaseSensitive);
+            }
+
+            if (bMatches)
+            {
+                Entry.LastUsed = ++UseCounter;
+                return Entry.Path.ToSharedRef();
+            }
+        }
+    }
+
+    // encode outside the lock
+    TSharedRef<FGAProgressionPath, ESPMode::ThreadSafe> Path = MakeShared<FGAProgressionPath, ESPMode::ThreadSafe>();
+    Path->NumParts = NumParts;
+    for (int32 i = 0; i < NumParts; ++i)
+    {
+        FTCHARToUTF8 Converted(*Hierarchy[i]);
+        Path->Parts[i].SetNumUninitialized(Converted.Length() + 1);
+        FMemory::Memcpy(Path->Parts[i].GetData(), Converted.Get(), Converted.Length());
+        Path->Parts[i][Converted.Length()] = '\0';
+    }
+
+    FScopeLock ScopeLock(&Lock);
+
+    FEntry* Slot = nullptr;
+    if (Entries.Num() < Capacity)
+    {
+        Slot = &Entries[Entries.AddDefaulted()];
+    }
+    else
+    {
+        Slot = &Entries[0];
+        for (FEntry& Entry : Entries)
+        {
+            if (Entry.LastUsed < Slot->LastUsed)
+            {
+                Slot = &Entry;
+            }
+        }
+    }
+
+    Slot->Hash = Hash;
+    Slot->LastUsed = ++UseCounter;
+    Slot->Hierarchy = TArray<FString>(Hierarchy.GetData(), NumParts);
+    Slot->Path = Path;
+    return Path;
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+/** Up to three progression parts, encoded as null terminated UTF-8 */
+struct FGAProgressionPath
+{
+    /** Part Index, nullptr past the last part */
+    const ANSICHAR* Get(int32 Index) const
+    {
+        return Index < NumParts ? Parts[Index].GetData() : nullptr;
+    }
+
+    TArray<ANSICHAR> Parts[3];
+    int32 NumParts = 0;
+};
+
+/**
+ * Small LRU of recently recorded progression hierarchies and their UTF-8 encoding.
+ * Wave based modes record the same few hierarchies over and over, a hit skips the conversion of every part.
+ * Entries are immutable and shared, so a path handed out stays valid after it was evicted.
+ */
+class FGAProgressionPathCache
+{
+public:
+    typedef TSharedRef<const FGAProgressionPath, ESPMode::ThreadSafe> FPathRef;
+
+    /** Encoded form of the first three parts of Hierarchy, Hierarchy must not be empty */
+    FPathRef Get(TConstArrayView<FString> Hierarchy);
+
+private:
+    struct FEntry
+    {
+        uint32 Hash = 0;
+        uint64 LastUsed = 0;
+        TArray<FString> Hierarchy;
+        TSharedPtr<const FGAProgressionPath, ESPMode::ThreadSafe> Path;
+    };
+
+    static constexpr int32 Capacity = 32;
+
+    FCriticalSection Lock;
+    TArray<FEntry> Entries;
+    uint64 UseCounter = 0;
+};
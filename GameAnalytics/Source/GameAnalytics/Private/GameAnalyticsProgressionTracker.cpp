@@ -0,0 +1,115 @@
+#include "GameAnalyticsProgressionTracker.h"
+#include "Hash/CityHash.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/CString.h"
+#include "HAL/PlatformTime.h"
+
+void FGAProgressionTracker::SetEnabled(bool bEnabled)
+{
+    FScopeLock ScopeLock(&Lock);
+
+    if (bEnabled && Entries.Num() == 0)
+    {
+        Entries.SetNum(Capacity);
+    }
+    else if (!bEnabled)
+    {
+        Entries.Empty();
+    }
+    bIsEnabled.store(bEnabled, std::memory_order_relaxed);
+}
+
+bool FGAProgressionTracker::Track(EGAProgressionStatus Status, const ANSICHAR* Progression01, const ANSICHAR* Progression02, const ANSICHAR* Progression03, FTiming& OutTiming)
+{
+    const uint64 PathHash = HashPath(Progression01, Progression02, Progression03);
+    const double Now = FPlatformTime::Seconds();
+
+    FScopeLock ScopeLock(&Lock);
+    if (Entries.Num() == 0)
+    {
+        return false;
+    }
+
+    if (Status == EGAProgressionStatus::start)
+    {
+        FEntry* Entry = FindEntry(PathHash, true);
+        Entry->StartTime = Now;
+        Entry->LastTouched = Now;
+        Entry->Attempts++;
+        Entry->bStarted = true;
+        return false;
+    }
+
+    FEntry* Entry = FindEntry(PathHash, false);
+    if (Entry == nullptr || !Entry->bStarted)
+    {
+        return false;
+    }
+
+    OutTiming.ElapsedSeconds = Now - Entry->StartTime;
+    OutTiming.Attempt = Entry->Attempts;
+
+    Entry->bStarted = false;
+    Entry->LastTouched = Now;
+    if (Status == EGAProgressionStatus::complete)
+    {
+        // the next start begins a new series of attempts, the slot stays interned for reuse
+        Entry->Attempts = 0;
+    }
+    return true;
+}
+
+uint64 FGAProgressionTracker::HashPath(const ANSICHAR* Progression01, const ANSICHAR* Progression02, const ANSICHAR* Progression03)
+{
+    // the part index is mixed into the seed so "a", "b" and "ab" do not collide
+    uint64 Hash = 0;
+    const ANSICHAR* Parts[] = { Progression01, Progression02, Progression03 };
+    for (int32 i = 0; i < 3; ++i)
+    {
+        const ANSICHAR* Part = Parts[i] != nullptr ? Parts[i] : "";
+        Hash = CityHash64WithSeed(Part, FCStringAnsi::Strlen(Part), Hash + i);
+    }
+    // 0 marks a free slot
+    return Hash != 0 ? Hash : 1;
+}
+
+FGAProgressionTracker::FEntry* FGAProgressionTracker::FindEntry(uint64 PathHash, bool bCreate)
+{
+    const int32 Mask = Capacity - 1;
+    const int32 Home = (int32)(PathHash & Mask);
+
+    FEntry* Stalest = nullptr;
+    for (int32 Probe = 0; Probe < MaxProbe; ++Probe)
+    {
+        FEntry& Entry = Entries[(Home + Probe) & Mask];
+        if (Entry.PathHash == PathHash)
+        {
+            return &Entry;
+        }
+
+        if (Entry.PathHash == 0)
+        {
+            if (!bCreate)
+            {
+                return nullptr;
+            }
+            Entry.PathHash = PathHash;
+            return &Entry;
+        }
+
+        // idle paths go before ones that are still running
+        if (Stalest == nullptr || (Stalest->bStarted && !Entry.bStarted) || (Stalest->bStarted == Entry.bStarted && Entry.LastTouched < Stalest->LastTouched))
+        {
+            Stalest = &Entry;
+        }
+    }
+
+    if (!bCreate)
+    {
+        return nullptr;
+    }
+
+    *Stalest = FEntry();
+    Stalest->PathHash = PathHash;
+    return Stalest;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "GameAnalytics.h"
+
+#include <atomic>
+
+/**
+ * Pairs progression start events with their complete and fail events.
+ * Paths are interned as a 64-bit hash of their 1-3 parts into a fixed size open addressing table, so memory stays
+ * bounded no matter how many paths a game opens. Lookups probe a bounded window, when it is full the stalest entry
+ * in it is replaced.
+ */
+class FGAProgressionTracker
+{
+public:
+    /** Time since the last start and number of starts since the last complete */
+    struct FTiming
+    {
+        double ElapsedSeconds = 0.0;
+        int32 Attempt = 0;
+    };
+
+    /** Allocates the table on enable and releases it on disable */
+    void SetEnabled(bool bEnabled);
+
+    bool IsEnabled() const
+    {
+        return bIsEnabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Records a progression event.
+     * @return true when a complete or fail event matched an earlier start and OutTiming was filled
+     */
+    bool Track(EGAProgressionStatus Status, const ANSICHAR* Progression01, const ANSICHAR* Progression02, const ANSICHAR* Progression03, FTiming& OutTiming);
+
+private:
+    struct FEntry
+    {
+        uint64 PathHash = 0;
+        double StartTime = 0.0;
+        double LastTouched = 0.0;
+        int32 Attempts = 0;
+        bool bStarted = false;
+    };
+
+    static constexpr int32 Capacity = 4096;
+    static constexpr int32 MaxProbe = 16;
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    static uint64 HashPath(const ANSICHAR* Progression01, const ANSICHAR* Progression02, const ANSICHAR* Progression03);
+
+    /** Slot of the path, nullptr when it is not tracked and bCreate is false */
+    FEntry* FindEntry(uint64 PathHash, bool bCreate);
+
+    std::atomic<bool> bIsEnabled{ false };
+    FCriticalSection Lock;
+    TArray<FEntry> Entries;
+};
@@ -6,6 +6,10 @@
 #include "UObject/Package.h"
 #include "Interfaces/IAnalyticsProviderModule.h"
 #include "UObject/UObjectGlobals.h"
+#include "Containers/ArrayView.h"
+#include "Async/Future.h"
+#include "GameAnalytics.h"
+#include "GameAnalyticsProgressionPathCache.h"
 
 class FAnalyticsProviderGameAnalytics :
     public IAnalyticsProvider
@@ -27,12 +31,17 @@ class FAnalyticsProviderGameAnalytics :
     /** Settings for GameAnalytics, loaded from project configuration files */
     FAnalyticsGameAnalytics::FGameAnalyticsProjectSettings ProjectSettings;
 
+    /** Pending backend initialization when UseDeferredInitialization is set */
+    TFuture<void> DeferredInitialization;
+
 public:
 
     FAnalyticsProviderGameAnalytics();
     virtual ~FAnalyticsProviderGameAnalytics();
 
     virtual bool StartSession(const TArray<FAnalyticsEventAttribute>& Attributes) override;
+    /** First StartSession with the given settings in place of the project settings, lets tests compare startup paths */
+    bool StartSessionWithSettings(const FAnalyticsGameAnalytics::FGameAnalyticsProjectSettings& Settings, const TArray<FAnalyticsEventAttribute>& Attributes);
     virtual void EndSession() override;
     virtual void FlushEvents() override;
 
@@ -67,4 +76,25 @@ public:
     virtual void RecordProgress(const FString& ProgressType, const FString& ProgressHierarchy);
     virtual void RecordProgress(const FString& ProgressType, const FString& ProgressHierarchy, const TArray<FAnalyticsEventAttribute>& Attributes);
     virtual void RecordProgress(const FString& ProgressType, const TArray<FString>& ProgressHierarchy, const TArray<FAnalyticsEventAttribute>& Attributes);
+
+private:
+    /** Collects the backend configuration from the project settings and the StartSession attributes */
+    FGAConfiguration BuildConfiguration(const TArray<FAnalyticsEventAttribute>& Attributes) const;
+
+    /** Blocks until a deferred initialization has completed, no-op otherwise */
+    void WaitForDeferredInitialization();
+
+    /**
+     * Shared implementations reading the attributes through a view, so no entry point copies an attribute.
+     * They run on the raising thread, submitEvent serializes and stages the resulting events there.
+     */
+    void RecordEventImpl(const FString& EventName, TConstArrayView<FAnalyticsEventAttribute> Attributes);
+    void RecordItemPurchaseImpl(const FString& ItemId, int ItemQuantity, TConstArrayView<FAnalyticsEventAttribute> Attributes);
+    void RecordCurrencyPurchaseImpl(const FString& GameCurrencyType, int GameCurrencyAmount, TConstArrayView<FAnalyticsEventAttribute> Attributes);
+    void RecordErrorImpl(const FString& Error, TConstArrayView<FAnalyticsEventAttribute> Attributes);
+    void RecordProgressImpl(const FString& ProgressType, const FString& ProgressHierarchy, TConstArrayView<FAnalyticsEventAttribute> Attributes);
+    void RecordProgressHierarchyImpl(const FString& ProgressType, TConstArrayView<FString> ProgressHierarchy, TConstArrayView<FAnalyticsEventAttribute> Attributes);
+
+    /** UTF-8 encoding of recently recorded progression hierarchies */
+    FGAProgressionPathCache ProgressionPaths;
 };
@@ -0,0 +1,71 @@
+#include "GameAnalyticsRemoteConfigs.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/JsonSerializer.h"
+
+bool FGARemoteConfigs::ParseContent(const FString& Content, TMap<FString, FString>& OutValues)
+{
+    OutValues.Reset();
+    if (Content.IsEmpty())
+    {
+        return false;
+    }
+
+    TSharedPtr<FJsonObject> ContentObject;
+    TSharedRef<TJsonReader<> > Reader = TJsonReaderFactory<>::Create(Content);
+    if (!FJsonSerializer::Deserialize(Reader, ContentObject) || !ContentObject.IsValid())
+    {
+        return false;
+    }
+
+    OutValues.Reserve(ContentObject->Values.Num());
+    for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : ContentObject->Values)
+    {
+        FString Value;
+        if (!Pair.Value.IsValid() || !Pair.Value->TryGetString(Value))
+        {
+            // objects and arrays are handed over as their JSON text
+            TSharedRef<TJsonWriter<> > Writer = TJsonWriterFactory<>::Create(&Value);
+            FJsonSerializer::Serialize(Pair.Value, FString(), Writer);
+        }
+        OutValues.Add(Pair.Key, MoveTemp(Value));
+    }
+
+    return true;
+}
+
+void FGARemoteConfigs::Update(const FString& Content, TArray<FChange>& OutChanges)
+{
+    OutChanges.Reset();
+    if (Content.Equals(LastContent, ESearchCase::CaseSensitive))
+    {
+        return;
+    }
+
+    TMap<FString, FString> Values;
+    if (!ParseContent(Content, Values))
+    {
+        return;
+    }
+
+    for (const TPair<FString, FString>& Pair : Values)
+    {
+        const FString* OldValue = Snapshot.Find(Pair.Key);
+        if (OldValue == nullptr || !OldValue->Equals(Pair.Value, ESearchCase::CaseSensitive))
+        {
+            OutChanges.Add(FChange{ Pair.Key, OldValue != nullptr ? *OldValue : FString(), Pair.Value });
+        }
+    }
+
+    for (const TPair<FString, FString>& Pair : Snapshot)
+    {
+        if (!Values.Contains(Pair.Key))
+        {
+            OutChanges.Add(FChange{ Pair.Key, Pair.Value, FString() });
+        }
+    }
+
+    Snapshot = MoveTemp(Values);
+    LastContent = Content;
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Parsing of the remote configs payload returned by getRemoteConfigsContentAsString.
+ * Lets the bulk getters read every key from a single native call, and keeps the last snapshot
+ * so a refresh only reports the keys whose value changed.
+ */
+class FGARemoteConfigs
+{
+public:
+    struct FChange
+    {
+        FString Key;
+        /** Empty when the key was added */
+        FString OldValue;
+        /** Empty when the key was removed */
+        FString NewValue;
+    };
+
+    /**
+     * Parses the payload into key/value pairs.
+     * String values are stored as is, other JSON values keep their JSON text.
+     * @return false when the payload is empty or not a JSON object
+     */
+    static bool ParseContent(const FString& Content, TMap<FString, FString>& OutValues);
+
+    /**
+     * Diffs a fresh payload against the previous snapshot and makes it the new snapshot.
+     * An unchanged payload is detected before parsing, an unparsable one leaves the snapshot untouched.
+     */
+    void Update(const FString& Content, TArray<FChange>& OutChanges);
+
+private:
+    FString LastContent;
+    TMap<FString, FString> Snapshot;
+};
@@ -0,0 +1,12 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("GameAnalytics"), STATGROUP_GameAnalytics, STATCAT_Advanced);
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Rejected resource events"), STAT_GameAnalytics_RejectedResourceEvents, STATGROUP_GameAnalytics, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Dropped custom fields"), STAT_GameAnalytics_DroppedCustomFields, STATGROUP_GameAnalytics, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Truncated custom field values"), STAT_GameAnalytics_TruncatedCustomFieldValues, STATGROUP_GameAnalytics, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Business events with an invalid receipt"), STAT_GameAnalytics_InvalidReceipts, STATGROUP_GameAnalytics, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Suppressed error events"), STAT_GameAnalytics_SuppressedErrorEvents, STATGROUP_GameAnalytics, );
@@ -0,0 +1,47 @@
+#include "GameAnalyticsStringSink.h"
+#include "Containers/StringConv.h"
+
+void FGAFStringSink::SetUtf8(const ANSICHAR* Data, int32 Length)
+{
+    TArray<TCHAR>& Chars = Target.GetCharArray();
+    if (Length <= 0)
+    {
+        Chars.Reset();
+        return;
+    }
+
+#if ENGINE_MAJOR_VERSION >= 5
+    // size first, then decode in place
+    const int32 ConvertedLength = FPlatformString::ConvertedLength<TCHAR>(reinterpret_cast<const UTF8CHAR*>(Data), Length);
+    Chars.SetNumUninitialized(ConvertedLength + 1);
+    FPlatformString::Convert(Chars.GetData(), ConvertedLength, reinterpret_cast<const UTF8CHAR*>(Data), Length);
+    Chars[ConvertedLength] = TEXT('\0');
+#else
+    FUTF8ToTCHAR Converted(Data, Length);
+    Chars.SetNumUninitialized(Converted.Length() + 1);
+    FMemory::Memcpy(Chars.GetData(), Converted.Get(), Converted.Length() * sizeof(TCHAR));
+    Chars[Converted.Length()] = TEXT('\0');
+#endif
+}
+
+void FGAFStringSink::SetUtf16(const UTF16CHAR* Data, int32 Length)
+{
+    TArray<TCHAR>& Chars = Target.GetCharArray();
+    if (Length <= 0)
+    {
+        Chars.Reset();
+        return;
+    }
+
+#if PLATFORM_TCHAR_IS_CHAR16
+    // TCHAR already is UTF-16, a single copy into the string's own storage
+    Chars.SetNumUninitialized(Length + 1);
+    FMemory::Memcpy(Chars.GetData(), Data, Length * sizeof(TCHAR));
+    Chars[Length] = TEXT('\0');
+#else
+    auto Converted = StringCast<TCHAR>(Data, Length);
+    Chars.SetNumUninitialized(Converted.Length() + 1);
+    FMemory::Memcpy(Chars.GetData(), Converted.Get(), Converted.Length() * sizeof(TCHAR));
+    Chars[Converted.Length()] = TEXT('\0');
+#endif
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Destination for strings handed back by the native SDKs.
+ * Each backend passes the characters in the encoding it already holds (UTF-16 from Java, UTF-8 from Objective-C
+ * and the C++ SDK) and the sink decodes them straight into the caller's storage, without an intermediate buffer.
+ */
+class FGAStringSink
+{
+public:
+    virtual ~FGAStringSink() {}
+
+    /** Replaces the content with Length UTF-8 code units, Data does not need to be null terminated */
+    virtual void SetUtf8(const ANSICHAR* Data, int32 Length) = 0;
+
+    /** Replaces the content with Length UTF-16 code units, Data does not need to be null terminated */
+    virtual void SetUtf16(const UTF16CHAR* Data, int32 Length) = 0;
+};
+
+/** Decodes into a caller provided FString */
+class FGAFStringSink : public FGAStringSink
+{
+public:
+    explicit FGAFStringSink(FString& InTarget)
+        : Target(InTarget)
+    {
+    }
+
+    virtual void SetUtf8(const ANSICHAR* Data, int32 Length) override;
+    virtual void SetUtf16(const UTF16CHAR* Data, int32 Length) override;
+
+private:
+    FString& Target;
+};
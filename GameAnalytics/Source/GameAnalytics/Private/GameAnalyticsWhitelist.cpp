@@ -0,0 +1,83 @@
+#include "GameAnalyticsWhitelist.h"
+#include "GameAnalytics.h"
+#include "Misc/ScopeLock.h"
+
+static void AssignUtf8(TArray<ANSICHAR>& Out, const ANSICHAR* Value)
+{
+    const int32 Length = FCStringAnsi::Strlen(Value);
+    Out.Reset(Length + 1);
+    Out.Append(Value, Length + 1);
+}
+
+void FGAStringWhitelist::Reset(const TArray<FString>& Values)
+{
+    FRWScopeLock WriteLock(Lock, SLT_Write);
+
+    Entries.Reset();
+    Entries.Reserve(Values.Num());
+    StringEntries.Reset();
+    StringEntries.Reserve(Values.Num());
+    for (const FString& Value : Values)
+    {
+        TArray<ANSICHAR> Entry;
+        AssignUtf8(Entry, TCHAR_TO_UTF8(*Value));
+        Entries.Add(MoveTemp(Entry));
+        StringEntries.Add(Value);
+    }
+}
+
+bool FGAStringWhitelist::IsEmpty() const
+{
+    FRWScopeLock ReadLock(Lock, SLT_ReadOnly);
+    return Entries.Num() == 0;
+}
+
+bool FGAStringWhitelist::IsAllowed(const ANSICHAR* Value) const
+{
+    FRWScopeLock ReadLock(Lock, SLT_ReadOnly);
+    if (Entries.Num() == 0)
+    {
+        return true;
+    }
+    if (Value == nullptr)
+    {
+        return false;
+    }
+    return Entries.ContainsByHash(FCrc::StrCrc32(Value), Value);
+}
+
+bool FGAStringWhitelist::IsAllowed(const FString& Value) const
+{
+    FRWScopeLock ReadLock(Lock, SLT_ReadOnly);
+    return StringEntries.Num() == 0 || StringEntries.Contains(Value);
+}
+
+void FGACustomDimension::Configure(const TArray<FString>& Values)
+{
+    Whitelist.Reset(Values);
+}
+
+bool FGACustomDimension::Update(const ANSICHAR* Value)
+{
+    if (Value == nullptr)
+    {
+        Value = "";
+    }
+
+    // an empty value clears the dimension and is always accepted
+    if (*Value != '\0' && !Whitelist.IsAllowed(Value))
+    {
+        UE_LOG(LogGameAnalyticsAnalytics, Warning, TEXT("%s: '%s' is not in the configured list of available custom dimensions, ignoring it."), Name, UTF8_TO_TCHAR(Value));
+        return false;
+    }
+
+    FScopeLock Lock(&ValueLock);
+    if (bHasValue && FCStringAnsi::Strcmp(CurrentValue.GetData(), Value) == 0)
+    {
+        return false;
+    }
+
+    AssignUtf8(CurrentValue, Value);
+    bHasValue = true;
+    return true;
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Set.h"
+#include "Misc/Crc.h"
+#include "Misc/CString.h"
+#include "Misc/ScopeRWLock.h"
+#include "HAL/CriticalSection.h"
+
+/**
+ * Flat hash set of the values configured through configureAvailable*.
+ * Entries are kept both as UTF-8 and as FString, so the low-level const char* API and the Blueprint FString API
+ * can look up their arguments without converting them.
+ * Matching is case sensitive, the same way the native SDKs compare them.
+ */
+class FGAStringWhitelist
+{
+public:
+    /** Replaces the entries, an empty list disables validation */
+    void Reset(const TArray<FString>& Values);
+
+    /** True when no whitelist was configured */
+    bool IsEmpty() const;
+
+    /** True when the value is whitelisted or no whitelist was configured */
+    bool IsAllowed(const ANSICHAR* Value) const;
+    bool IsAllowed(const FString& Value) const;
+
+private:
+    struct FKeyFuncs : BaseKeyFuncs<TArray<ANSICHAR>, TArray<ANSICHAR>, false>
+    {
+        static const TArray<ANSICHAR>& GetSetKey(const TArray<ANSICHAR>& Element)
+        {
+            return Element;
+        }
+
+        static bool Matches(const TArray<ANSICHAR>& A, const TArray<ANSICHAR>& B)
+        {
+            return FCStringAnsi::Strcmp(A.GetData(), B.GetData()) == 0;
+        }
+
+        static bool Matches(const TArray<ANSICHAR>& A, const ANSICHAR* B)
+        {
+            return FCStringAnsi::Strcmp(A.GetData(), B) == 0;
+        }
+
+        static uint32 GetKeyHash(const TArray<ANSICHAR>& Key)
+        {
+            return FCrc::StrCrc32(Key.GetData());
+        }
+    };
+
+    struct FStringKeyFuncs : BaseKeyFuncs<FString, FString, false>
+    {
+        static const FString& GetSetKey(const FString& Element)
+        {
+            return Element;
+        }
+
+        static bool Matches(const FString& A, const FString& B)
+        {
+            return A.Equals(B, ESearchCase::CaseSensitive);
+        }
+
+        static uint32 GetKeyHash(const FString& Key)
+        {
+            return FCrc::StrCrc32(*Key);
+        }
+    };
+
+    TSet<TArray<ANSICHAR>, FKeyFuncs> Entries;
+    TSet<FString, FStringKeyFuncs> StringEntries;
+    mutable FRWLock Lock;
+};
+
+/**
+ * Last value handed to the native SDK for one custom dimension, plus its whitelist.
+ * Lets setCustomDimension0x skip the native crossing when the value did not change.
+ */
+class FGACustomDimension
+{
+public:
+    explicit FGACustomDimension(const TCHAR* InName)
+        : Name(InName)
+    {
+    }
+
+    void Configure(const TArray<FString>& Values);
+
+    /**
+     * Records the new value.
+     * @return false when the value is identical to the current one or not whitelisted, so nothing needs to reach the native SDK
+     */
+    bool Update(const ANSICHAR* Value);
+
+private:
+    const TCHAR* Name;
+    FGAStringWhitelist Whitelist;
+
+    FCriticalSection ValueLock;
+    TArray<ANSICHAR> CurrentValue;
+    bool bHasValue = false;
+};
@@ -1,5 +1,16 @@
 #import "../../GA-SDK-IOS/GameAnalytics.h"
 #import "../../GA-SDK-IOS/GameAnalyticsCpp.h"
+#include "GameAnalyticsStringSink.h"
+
+// Hands the UTF-8 bytes of the string to the sink, no std::string or heap copy in between
+static void WriteNSString(NSString *value, FGAStringSink& out) {
+    const char *utf8 = value != nil ? [value UTF8String] : NULL;
+    if (utf8 == NULL) {
+        out.SetUtf8(NULL, 0);
+        return;
+    }
+    out.SetUtf8(utf8, (int32)strlen(utf8));
+}
 
 void GameAnalyticsCpp::configureAvailableCustomDimensions01(const std::vector<std::string>& list) {
     NSMutableArray * tmpary = [[NSMutableArray alloc] initWithCapacity: list.size()];
@@ -75,6 +86,46 @@ void GameAnalyticsCpp::configureGameEngineVersion(const char *gameEngineVersion)
     [GameAnalytics configureEngineVersion:gameEngineVersionString];
 }
 
+void GameAnalyticsCpp::configure(const char *configuration) {
+    NSString *configurationString = configuration != NULL ? [NSString stringWithUTF8String:configuration] : nil;
+    if (!configurationString) {
+        return;
+    }
+    NSDictionary *configuration_dict = [NSJSONSerialization JSONObjectWithData:[configurationString dataUsingEncoding:NSUTF8StringEncoding] options:kNilOptions error:nil];
+    if (![configuration_dict isKindOfClass:[NSDictionary class]]) {
+        return;
+    }
+
+    // keys are only present when the matching configure call should be made
+    [GameAnalytics setEnabledInfoLog:[configuration_dict[@"infoLog"] boolValue]];
+    [GameAnalytics setEnabledVerboseLog:[configuration_dict[@"verboseLog"] boolValue]];
+    if (configuration_dict[@"autoDetectAppVersion"]) {
+        [GameAnalytics configureAutoDetectAppVersion:[configuration_dict[@"autoDetectAppVersion"] boolValue]];
+    }
+    if (configuration_dict[@"build"]) {
+        [GameAnalytics configureBuild:configuration_dict[@"build"]];
+    }
+    if (configuration_dict[@"resourceCurrencies"]) {
+        [GameAnalytics configureAvailableResourceCurrencies:configuration_dict[@"resourceCurrencies"]];
+    }
+    if (configuration_dict[@"resourceItemTypes"]) {
+        [GameAnalytics configureAvailableResourceItemTypes:configuration_dict[@"resourceItemTypes"]];
+    }
+    if (configuration_dict[@"customDimensions01"]) {
+        [GameAnalytics configureAvailableCustomDimensions01:configuration_dict[@"customDimensions01"]];
+    }
+    if (configuration_dict[@"customDimensions02"]) {
+        [GameAnalytics configureAvailableCustomDimensions02:configuration_dict[@"customDimensions02"]];
+    }
+    if (configuration_dict[@"customDimensions03"]) {
+        [GameAnalytics configureAvailableCustomDimensions03:configuration_dict[@"customDimensions03"]];
+    }
+    if (configuration_dict[@"manualSessionHandling"]) {
+        [GameAnalytics setEnabledManualSessionHandling:[configuration_dict[@"manualSessionHandling"] boolValue]];
+    }
+    [GameAnalytics setEnabledErrorReporting:[configuration_dict[@"errorReporting"] boolValue]];
+}
+
 void GameAnalyticsCpp::initialize(const char *gameKey, const char *gameSecret) {
     NSString *gameKeyString = gameKey != NULL ? [NSString stringWithUTF8String:gameKey] : nil;
     NSString *gameSecretString = gameSecret != NULL ? [NSString stringWithUTF8String:gameSecret] : nil;
@@ -310,56 +361,41 @@ void GameAnalyticsCpp::endSession() {
     [GameAnalytics endSession];
 }
 
-void GameAnalyticsCpp::getRemoteConfigsValueAsString(const char *key, char** out) {
+void GameAnalyticsCpp::getRemoteConfigsValueAsString(const char *key, FGAStringSink& out) {
     NSString *keyString = key != NULL ? [NSString stringWithUTF8String:key] : nil;
     NSString *result = [GameAnalytics getRemoteConfigsValueAsString:keyString];
 
-    std::string s = result != nil ? [result UTF8String] : "";
-    char* tmp = new char[s.size() + 1];
-    snprintf(tmp, s.size() + 1, "%s", s.c_str());
-    *out = tmp;
+    WriteNSString(result, out);
 }
 
-void GameAnalyticsCpp::getRemoteConfigsValueAsString(const char *key, const char *defaultValue, char** out) {
+void GameAnalyticsCpp::getRemoteConfigsValueAsString(const char *key, const char *defaultValue, FGAStringSink& out) {
     NSString *keyString = key != NULL ? [NSString stringWithUTF8String:key] : nil;
     NSString *defaultValueString = key != NULL ? [NSString stringWithUTF8String:defaultValue] : nil;
     NSString *result = [GameAnalytics getRemoteConfigsValueAsString:keyString defaultValue:defaultValueString];
 
-    std::string s = result != nil ? [result UTF8String] : "";
-    char* tmp = new char[s.size() + 1];
-    snprintf(tmp, s.size() + 1, "%s", s.c_str());
-    *out = tmp;
+    WriteNSString(result, out);
 }
 
 bool GameAnalyticsCpp::isRemoteConfigsReady() {
     return [GameAnalytics isRemoteConfigsReady] ? true : false;
 }
 
-void GameAnalyticsCpp::getRemoteConfigsContentAsString(char** out) {
+void GameAnalyticsCpp::getRemoteConfigsContentAsString(FGAStringSink& out) {
     NSString *result = [GameAnalytics getRemoteConfigsContentAsString];
 
-    std::string s = result != nil ? [result UTF8String] : "";
-    char* tmp = new char[s.size() + 1];
-    snprintf(tmp, s.size() + 1, "%s", s.c_str());
-    *out = tmp;
+    WriteNSString(result, out);
 }
 
-void GameAnalyticsCpp::getABTestingId(char** out) {
+void GameAnalyticsCpp::getABTestingId(FGAStringSink& out) {
     NSString *result = [GameAnalytics getABTestingId];
 
-    std::string s = result != nil ? [result UTF8String] : "";
-    char* tmp = new char[s.size() + 1];
-    snprintf(tmp, s.size() + 1, "%s", s.c_str());
-    *out = tmp;
+    WriteNSString(result, out);
 }
 
-void GameAnalyticsCpp::getABTestingVariantId(char** out) {
+void GameAnalyticsCpp::getABTestingVariantId(FGAStringSink& out) {
     NSString *result = [GameAnalytics getABTestingVariantId];
 
-    std::string s = result != nil ? [result UTF8String] : "";
-    char* tmp = new char[s.size() + 1];
-    snprintf(tmp, s.size() + 1, "%s", s.c_str());
-    *out = tmp;
+    WriteNSString(result, out);
 }
 
 void GameAnalyticsCpp::useRandomizedId(bool value)
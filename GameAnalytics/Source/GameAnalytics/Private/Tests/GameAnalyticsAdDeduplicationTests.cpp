@@ -0,0 +1,86 @@
+#include "GameAnalyticsTests.h"
+#include "GameAnalyticsAdDeduplication.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGAAdEventDeduplicatorWindowTest, "GameAnalytics.AdDeduplication.Window", GA_TEST_FLAGS)
+
+bool FGAAdEventDeduplicatorWindowTest::RunTest(const FString& Parameters)
+{
+    FGAAdEventDeduplicator Deduplicator;
+    TArray<int32> Submitted;
+    auto MakeSubmit = [&Submitted]() -> FGAAdEventDeduplicator::FSubmitFunction
+    {
+        return [&Submitted](int32 Count) { Submitted.Add(Count); };
+    };
+
+    TestFalse(TEXT("Nothing is held while disabled"), Deduplicator.Add(1, MakeSubmit));
+
+    Deduplicator.SetWindow(60.0);
+    TestTrue(TEXT("The first event is held"), Deduplicator.Add(1, MakeSubmit));
+    TestTrue(TEXT("A duplicate is counted"), Deduplicator.Add(1, MakeSubmit));
+    TestTrue(TEXT("Another key is held on its own"), Deduplicator.Add(2, MakeSubmit));
+
+    Deduplicator.Flush(true);
+    TestEqual(TEXT("Nothing expires inside the window"), Submitted.Num(), 0);
+
+    Deduplicator.Flush(false);
+    Submitted.Sort();
+    TestEqual(TEXT("Every key is submitted once"), Submitted.Num(), 2);
+    TestTrue(TEXT("Counts of the held events"), Submitted.Num() == 2 && Submitted[0] == 1 && Submitted[1] == 2);
+
+    // held events are submitted when the window is closed, later events are not taken
+    Submitted.Reset();
+    Deduplicator.Add(3, MakeSubmit);
+    Deduplicator.SetWindow(0.0);
+    TestEqual(TEXT("Disabling submits the held events"), Submitted.Num(), 1);
+    TestFalse(TEXT("Nothing is held after disabling"), Deduplicator.Add(3, MakeSubmit));
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGAAdEventDeduplicatorCapacityTest, "GameAnalytics.AdDeduplication.Capacity", GA_TEST_FLAGS)
+
+bool FGAAdEventDeduplicatorCapacityTest::RunTest(const FString& Parameters)
+{
+    FGAAdEventDeduplicator Deduplicator;
+    int32 NumSubmitted = 0;
+    auto MakeSubmit = [&NumSubmitted]() -> FGAAdEventDeduplicator::FSubmitFunction
+    {
+        return [&NumSubmitted](int32 Count) { NumSubmitted++; };
+    };
+
+    Deduplicator.SetWindow(60.0);
+    int32 NumHeld = 0;
+    for (uint64 Key = 1; Key <= 100; ++Key)
+    {
+        NumHeld += Deduplicator.Add(Key, MakeSubmit) ? 1 : 0;
+    }
+    TestTrue(TEXT("A full table hands events back"), NumHeld > 0 && NumHeld < 100);
+
+    Deduplicator.Flush(false);
+    TestEqual(TEXT("Every held event is submitted"), NumSubmitted, NumHeld);
+    TestTrue(TEXT("The flushed table takes events again"), Deduplicator.Add(101, MakeSubmit));
+
+    Deduplicator.SetWindow(0.0);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGAAdEventDeduplicatorKeyTest, "GameAnalytics.AdDeduplication.HashKey", GA_TEST_FLAGS)
+
+bool FGAAdEventDeduplicatorKeyTest::RunTest(const FString& Parameters)
+{
+    const uint64 Key = FGAAdEventDeduplicator::HashKey(1, 2, 3, 0, 0, false, "sdk", "placement", "{}", 2);
+
+    TestEqual(TEXT("Equal events share a key"), FGAAdEventDeduplicator::HashKey(1, 2, 3, 0, 0, false, "sdk", "placement", "{}", 2), Key);
+    TestNotEqual(TEXT("The no ad reason is part of the key"), FGAAdEventDeduplicator::HashKey(1, 2, 3, 1, 0, false, "sdk", "placement", "{}", 2), Key);
+    TestNotEqual(TEXT("The duration is part of the key"), FGAAdEventDeduplicator::HashKey(1, 2, 3, 0, 5, false, "sdk", "placement", "{}", 2), Key);
+    TestNotEqual(TEXT("The merge flag is part of the key"), FGAAdEventDeduplicator::HashKey(1, 2, 3, 0, 0, true, "sdk", "placement", "{}", 2), Key);
+    TestNotEqual(TEXT("The custom fields are part of the key"), FGAAdEventDeduplicator::HashKey(1, 2, 3, 0, 0, false, "sdk", "placement", "{\"a\":1}", 7), Key);
+    TestNotEqual(TEXT("Characters moved between the sdk and the placement change the key"), FGAAdEventDeduplicator::HashKey(1, 2, 3, 0, 0, false, "sdkp", "lacement", "{}", 2), Key);
+    TestNotEqual(TEXT("A key is never the free slot marker"), Key, (uint64)0);
+
+    return true;
+}
+
+#endif
@@ -0,0 +1,69 @@
+#include "GameAnalyticsTests.h"
+#include "GameAnalyticsErrorRateLimiter.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGAErrorFingerprintTest, "GameAnalytics.ErrorRateLimiter.Fingerprint", GA_TEST_FLAGS)
+
+bool FGAErrorFingerprintTest::RunTest(const FString& Parameters)
+{
+    const EGAErrorSeverity Error = EGAErrorSeverity::error;
+
+    TestEqual(TEXT("Numbers are masked"),
+        FGAErrorRateLimiter::Fingerprint(Error, "Failed to load item 12"),
+        FGAErrorRateLimiter::Fingerprint(Error, "Failed to load item 99310"));
+
+    TestEqual(TEXT("Addresses are masked"),
+        FGAErrorRateLimiter::Fingerprint(Error, "Access violation at 0x7ffe12a0"),
+        FGAErrorRateLimiter::Fingerprint(Error, "Access violation at 0x1234"));
+
+    TestEqual(TEXT("Hex words starting with a letter are masked"),
+        FGAErrorRateLimiter::Fingerprint(Error, "Missing asset deadbeef5678"),
+        FGAErrorRateLimiter::Fingerprint(Error, "Missing asset cafebabe"));
+
+    TestNotEqual(TEXT("Short hex words stay text"),
+        FGAErrorRateLimiter::Fingerprint(Error, "bad face"),
+        FGAErrorRateLimiter::Fingerprint(Error, "bad cafe"));
+
+    TestNotEqual(TEXT("Hex digits inside a word stay text"),
+        FGAErrorRateLimiter::Fingerprint(Error, "Unknown actor abcdefabcd_x"),
+        FGAErrorRateLimiter::Fingerprint(Error, "Unknown actor fedcbafedc_x"));
+
+    TestNotEqual(TEXT("The severity is part of the fingerprint"),
+        FGAErrorRateLimiter::Fingerprint(EGAErrorSeverity::warning, "Same message"),
+        FGAErrorRateLimiter::Fingerprint(Error, "Same message"));
+
+    TestEqual(TEXT("A null message is an empty one"),
+        FGAErrorRateLimiter::Fingerprint(Error, nullptr),
+        FGAErrorRateLimiter::Fingerprint(Error, ""));
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGAErrorRateLimiterBurstTest, "GameAnalytics.ErrorRateLimiter.Burst", GA_TEST_FLAGS)
+
+bool FGAErrorRateLimiterBurstTest::RunTest(const FString& Parameters)
+{
+    FGAErrorRateLimiter Limiter;
+
+    FGAErrorRateLimit Limit;
+    Limit.Burst = 2;
+    Limit.PerMinute = 0.0f;
+    Limiter.SetLimit(EGAErrorSeverity::error, Limit);
+
+    TestTrue(TEXT("First error of the burst"), Limiter.Allow(EGAErrorSeverity::error, "Timeout after 10 ms"));
+    TestTrue(TEXT("Second error of the burst"), Limiter.Allow(EGAErrorSeverity::error, "Timeout after 20 ms"));
+    TestFalse(TEXT("Over the burst"), Limiter.Allow(EGAErrorSeverity::error, "Timeout after 30 ms"));
+    TestTrue(TEXT("Another fingerprint has its own budget"), Limiter.Allow(EGAErrorSeverity::error, "Disconnected"));
+
+    Limit.Burst = 0;
+    Limiter.SetLimit(EGAErrorSeverity::warning, Limit);
+    for (int32 i = 0; i < 20; ++i)
+    {
+        TestTrue(TEXT("A burst of zero disables the limit"), Limiter.Allow(EGAErrorSeverity::warning, "Repeated warning"));
+    }
+
+    return true;
+}
+
+#endif
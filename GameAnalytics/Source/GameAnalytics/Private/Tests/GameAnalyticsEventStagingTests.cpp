@@ -0,0 +1,68 @@
+#include "GameAnalyticsTests.h"
+#include "GameAnalyticsEventStaging.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    TArray<int32> GStagedPayloads;
+
+    void RecordPayload(const uint8* Payload, int32 Size)
+    {
+        int32 Value = 0;
+        if (Size == sizeof(int32))
+        {
+            FMemory::Memcpy(&Value, Payload, sizeof(int32));
+        }
+        GStagedPayloads.Add(Value);
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGAEventStagingOverflowTest, "GameAnalytics.EventStaging.Overflow", GA_TEST_FLAGS)
+
+bool FGAEventStagingOverflowTest::RunTest(const FString& Parameters)
+{
+    FGameAnalyticsEventStaging* Staging = FGameAnalyticsEventStaging::sharedInstance();
+    const bool bWasEnabled = FGameAnalyticsEventStaging::IsEnabled();
+    Staging->Flush();
+    FGameAnalyticsEventStaging::SetEnabled(true);
+
+    // more than one ring, the tail of the burst goes through the overflow queue
+    const int32 NumEvents = 600;
+    TArray<int32> Submitted;
+    for (int32 Index = 0; Index < NumEvents; ++Index)
+    {
+        FGameAnalyticsEventStaging::Enqueue([&Submitted, Index]()
+        {
+            Submitted.Add(Index);
+        });
+    }
+
+    Staging->Flush();
+    TestEqual(TEXT("Every event is submitted"), Submitted.Num(), NumEvents);
+    bool bInOrder = true;
+    for (int32 Index = 0; Index < Submitted.Num(); ++Index)
+    {
+        bInOrder &= Submitted[Index] == Index;
+    }
+    TestTrue(TEXT("Ring and overflow events keep the order they were raised in"), bInOrder);
+
+    // the ring is usable again once the overflow queue has been drained
+    GStagedPayloads.Reset();
+    for (int32 Index = 0; Index < 3; ++Index)
+    {
+        FGameAnalyticsEventStaging::Enqueue(&RecordPayload, [Index](TArray<uint8>& Payload)
+        {
+            Payload.Append(reinterpret_cast<const uint8*>(&Index), sizeof(int32));
+        });
+    }
+
+    FGameAnalyticsEventStaging::SetEnabled(false);
+    TestEqual(TEXT("Disabling flushes the payload events"), GStagedPayloads.Num(), 3);
+    TestTrue(TEXT("Payloads are submitted as written"), GStagedPayloads.Num() == 3 && GStagedPayloads[0] == 0 && GStagedPayloads[1] == 1 && GStagedPayloads[2] == 2);
+
+    FGameAnalyticsEventStaging::SetEnabled(bWasEnabled);
+    return true;
+}
+
+#endif
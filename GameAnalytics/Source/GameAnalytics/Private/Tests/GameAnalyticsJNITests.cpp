@@ -0,0 +1,232 @@
+#include "GameAnalyticsTests.h"
+
+// the real JNI types exist on Android only, everywhere else the helpers run against the counting environment below
+#if WITH_DEV_AUTOMATION_TESTS && !PLATFORM_ANDROID
+
+class _jobject {};
+class _jclass : public _jobject {};
+class _jstring : public _jobject {};
+class _jobjectArray : public _jobject {};
+struct _jmethodID;
+
+typedef int32 jint;
+typedef int32 jsize;
+typedef _jobject* jobject;
+typedef _jclass* jclass;
+typedef _jstring* jstring;
+typedef _jobjectArray* jobjectArray;
+typedef _jmethodID* jmethodID;
+
+/**
+ * Stand-in for JNIEnv that only counts.
+ * Local references are tracked per pushed frame, so the high-water mark of a call is what the thread's
+ * local reference table would have to hold at its peak.
+ */
+class FGAFakeJNIEnv
+{
+public:
+    int32 NumNewStringUTF = 0;
+    int32 NumNewLocalRef = 0;
+    int32 NumPushLocalFrame = 0;
+    int32 NumPopLocalFrame = 0;
+    int32 NumCalls = 0;
+    int32 LiveLocalRefs = 0;
+    int32 PeakLocalRefs = 0;
+    int32 LiveGlobalRefs = 0;
+
+    /** Starts a new measurement, the peak is relative to the references alive now */
+    void ResetCounters()
+    {
+        NumNewStringUTF = NumNewLocalRef = NumPushLocalFrame = NumPopLocalFrame = NumCalls = 0;
+        PeakLocalRefs = LiveLocalRefs;
+    }
+
+    jint PushLocalFrame(jint Capacity)
+    {
+        NumPushLocalFrame++;
+        Frames.Add(0);
+        return 0;
+    }
+
+    jobject PopLocalFrame(jobject Result)
+    {
+        NumPopLocalFrame++;
+        LiveLocalRefs -= Frames.Pop();
+        return nullptr;
+    }
+
+    jstring NewStringUTF(const char* Value)
+    {
+        NumNewStringUTF++;
+        return (jstring)NewLocal();
+    }
+
+    jobject NewLocalRef(jobject Ref)
+    {
+        NumNewLocalRef++;
+        return NewLocal();
+    }
+
+    void DeleteLocalRef(jobject Ref)
+    {
+        if (Ref != nullptr)
+        {
+            LiveLocalRefs--;
+            if (Frames.Num() > 0)
+            {
+                Frames.Last()--;
+            }
+        }
+    }
+
+    jobject NewGlobalRef(jobject Ref)
+    {
+        LiveGlobalRefs++;
+        return NewHandle();
+    }
+
+    void DeleteGlobalRef(jobject Ref)
+    {
+        LiveGlobalRefs--;
+    }
+
+    void ExceptionClear()
+    {
+    }
+
+    jclass FindClass(const char* Name)
+    {
+        return (jclass)NewLocal();
+    }
+
+    jobjectArray NewObjectArray(jsize Length, jclass ElementClass, jobject Initial)
+    {
+        return (jobjectArray)NewLocal();
+    }
+
+    void SetObjectArrayElement(jobjectArray Array, jsize Index, jobject Value)
+    {
+    }
+
+    void CallStaticVoidMethod(jclass Class, jmethodID Method, ...)
+    {
+        NumCalls++;
+    }
+
+private:
+    jobject NewLocal()
+    {
+        LiveLocalRefs++;
+        PeakLocalRefs = FMath::Max(PeakLocalRefs, LiveLocalRefs);
+        if (Frames.Num() > 0)
+        {
+            Frames.Last()++;
+        }
+        return NewHandle();
+    }
+
+    jobject NewHandle()
+    {
+        // never dereferenced, only has to be distinct and non null
+        return reinterpret_cast<jobject>(++NextHandle);
+    }
+
+    TArray<int32> Frames;
+    UPTRINT NextHandle = 0;
+};
+
+typedef FGAFakeJNIEnv JNIEnv;
+
+#include "Android/GameAnalyticsJNIHelpers.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGAJniStringArrayTest, "GameAnalytics.JNI.ConfigureAvailableCustomDimensions", GA_TEST_FLAGS)
+
+bool FGAJniStringArrayTest::RunTest(const FString& Parameters)
+{
+    FGAFakeJNIEnv Env;
+
+    std::vector<std::string> List;
+    for (int32 i = 0; i < 100; ++i)
+    {
+        List.push_back("dimension_" + std::to_string(i));
+    }
+
+    // the first call also resolves java/lang/String once
+    FGAJniCalls::CallStaticVoidMethodWithStringArray(&Env, nullptr, nullptr, List);
+    Env.ResetCounters();
+
+    // the body of jni_configureAvailableCustomDimensions01 and the other String[] configure calls
+    FGAJniCalls::CallStaticVoidMethodWithStringArray(&Env, nullptr, nullptr, List);
+    TestEqual(TEXT("One frame is pushed"), Env.NumPushLocalFrame, 1);
+    TestEqual(TEXT("The frame is popped"), Env.NumPopLocalFrame, 1);
+    TestEqual(TEXT("One Java string per element"), Env.NumNewStringUTF, 100);
+    TestEqual(TEXT("One call into Java"), Env.NumCalls, 1);
+    TestEqual(TEXT("The array and one element at a time, whatever the length"), Env.PeakLocalRefs, 2);
+    TestEqual(TEXT("No local reference survives the call"), Env.LiveLocalRefs, 0);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGAJniDesignEventTest, "GameAnalytics.JNI.AddDesignEvent", GA_TEST_FLAGS)
+
+bool FGAJniDesignEventTest::RunTest(const FString& Parameters)
+{
+    FGAFakeJNIEnv Env;
+    FGAJniStringCache Cache;
+
+    // the body of jni_addDesignEvent, the event id misses the cache the first time
+    FGAJniCalls::CallStaticVoidMethodWithCachedString(&Env, Cache, nullptr, nullptr, "level:boss:killed", "{}", false);
+    TestEqual(TEXT("Miss: one frame is pushed"), Env.NumPushLocalFrame, 1);
+    TestEqual(TEXT("Miss: the frame is popped"), Env.NumPopLocalFrame, 1);
+    TestEqual(TEXT("Miss: the event id and the fields are decoded"), Env.NumNewStringUTF, 2);
+    TestEqual(TEXT("Miss: the event id is kept as a global reference"), Env.LiveGlobalRefs, 1);
+    TestEqual(TEXT("Miss: peak local references"), Env.PeakLocalRefs, 2);
+    TestEqual(TEXT("Miss: no local reference survives the call"), Env.LiveLocalRefs, 0);
+
+    Env.ResetCounters();
+    FGAJniCalls::CallStaticVoidMethodWithCachedString(&Env, Cache, nullptr, nullptr, "level:boss:killed", "{}", false);
+    TestEqual(TEXT("Hit: only the fields are decoded"), Env.NumNewStringUTF, 1);
+    TestEqual(TEXT("Hit: the cached id costs one local reference"), Env.NumNewLocalRef, 1);
+    TestEqual(TEXT("Hit: no further global reference"), Env.LiveGlobalRefs, 1);
+    TestEqual(TEXT("Hit: peak local references"), Env.PeakLocalRefs, 2);
+    TestEqual(TEXT("Hit: no local reference survives the call"), Env.LiveLocalRefs, 0);
+    TestEqual(TEXT("Hit: one call into Java"), Env.NumCalls, 1);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGAJniStringCacheTest, "GameAnalytics.JNI.StringCache", GA_TEST_FLAGS)
+
+bool FGAJniStringCacheTest::RunTest(const FString& Parameters)
+{
+    FGAFakeJNIEnv Env;
+    FGAJniStringCache Cache;
+
+    TestTrue(TEXT("A null value has no Java string"), Cache.Get(&Env, nullptr) == nullptr);
+    TestEqual(TEXT("A null value touches nothing"), Env.NumNewStringUTF + Env.NumNewLocalRef, 0);
+
+    jstring Miss = Cache.Get(&Env, "gold");
+    TestTrue(TEXT("Miss returns a string"), Miss != nullptr);
+    TestEqual(TEXT("Miss decodes the value"), Env.NumNewStringUTF, 1);
+    TestEqual(TEXT("Miss returns one local reference"), Env.LiveLocalRefs, 1);
+    TestEqual(TEXT("Miss keeps one global reference"), Env.LiveGlobalRefs, 1);
+    Env.DeleteLocalRef(Miss);
+
+    Env.ResetCounters();
+    jstring Hit = Cache.Get(&Env, "gold");
+    TestTrue(TEXT("Hit returns a string"), Hit != nullptr);
+    TestEqual(TEXT("Hit does not decode"), Env.NumNewStringUTF, 0);
+    TestEqual(TEXT("Hit creates one local reference"), Env.NumNewLocalRef, 1);
+    TestEqual(TEXT("Hit keeps the global reference"), Env.LiveGlobalRefs, 1);
+    Env.DeleteLocalRef(Hit);
+
+    Env.ResetCounters();
+    Env.DeleteLocalRef(Cache.Get(&Env, "gems"));
+    TestEqual(TEXT("Another value misses"), Env.NumNewStringUTF, 1);
+    TestTrue(TEXT("Another value has its own global reference, or replaced the slot"), Env.LiveGlobalRefs == 1 || Env.LiveGlobalRefs == 2);
+    TestEqual(TEXT("No local reference is left"), Env.LiveLocalRefs, 0);
+
+    return true;
+}
+
+#endif
@@ -0,0 +1,66 @@
+#include "GameAnalyticsTests.h"
+#include "GameAnalyticsJsonWriter.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/JsonSerializer.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Containers/StringConv.h"
+#include "HAL/PlatformTime.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGAJsonWriterBenchmarkTest, "GameAnalytics.JsonWriter.Benchmark", GA_TEST_FLAGS)
+
+bool FGAJsonWriterBenchmarkTest::RunTest(const FString& Parameters)
+{
+    // a typical custom fields payload
+    TSharedRef<FJsonObject> Fields = MakeShared<FJsonObject>();
+    Fields->SetStringField(TEXT("level"), TEXT("forest_03"));
+    Fields->SetStringField(TEXT("weapon"), TEXT("crossbow"));
+    Fields->SetStringField(TEXT("difficulty"), TEXT("hard"));
+    Fields->SetNumberField(TEXT("score"), 18250);
+    Fields->SetNumberField(TEXT("duration"), 93.5);
+    Fields->SetNumberField(TEXT("deaths"), 3);
+    Fields->SetBoolField(TEXT("first_try"), false);
+    Fields->SetBoolField(TEXT("used_hint"), true);
+
+    const int32 Iterations = 20000;
+    int64 Checksum = 0;
+
+    FGAJsonWriter Writer;
+    const double WriterStart = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < Iterations; ++Index)
+    {
+        Writer.Reset();
+        Writer.BeginObject();
+        Writer.WriteMembers(*Fields);
+        Writer.EndObject();
+        Checksum += Writer.GetData()[0] + Writer.Len();
+    }
+    const double WriterSeconds = FPlatformTime::Seconds() - WriterStart;
+
+    // what custom fields went through before FGAJsonWriter: an FString writer and a UTF-8 conversion per event
+    const double SerializerStart = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < Iterations; ++Index)
+    {
+        FString Serialized;
+        TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR> > > JsonWriter = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR> >::Create(&Serialized);
+        FJsonSerializer::Serialize(Fields, JsonWriter);
+        const FTCHARToUTF8 Utf8(*Serialized);
+        Checksum += Utf8.Get()[0] + Utf8.Length();
+    }
+    const double SerializerSeconds = FPlatformTime::Seconds() - SerializerStart;
+
+    AddInfo(FString::Printf(TEXT("FGAJsonWriter: %.3f us per payload"), WriterSeconds * 1000000.0 / Iterations));
+    AddInfo(FString::Printf(TEXT("FJsonSerializer::Serialize and UTF-8 conversion: %.3f us per payload"), SerializerSeconds * 1000000.0 / Iterations));
+    if (WriterSeconds > 0.0)
+    {
+        AddInfo(FString::Printf(TEXT("Speedup: %.2fx"), SerializerSeconds / WriterSeconds));
+    }
+    TestTrue(TEXT("Both serializers produced output"), Checksum > 0);
+
+    return true;
+}
+
+#endif
@@ -0,0 +1,117 @@
+#include "GameAnalyticsTests.h"
+#include "GameAnalyticsJsonWriter.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    /** Byte comparison, the content is UTF-8 */
+    bool ContentEquals(FGAJsonWriter& Writer, const ANSICHAR* Expected)
+    {
+        const int32 ExpectedLength = FCStringAnsi::Strlen(Expected);
+        return Writer.Len() == ExpectedLength && FMemory::Memcmp(Writer.GetData(), Expected, ExpectedLength) == 0;
+    }
+
+    void WriteStringObject(FGAJsonWriter& Writer, const TCHAR* Value, int32 Length)
+    {
+        Writer.Reset();
+        Writer.BeginObject();
+        Writer.WriteStringMember(TEXT("k"), Value, Length);
+        Writer.EndObject();
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGAJsonWriterEscapingTest, "GameAnalytics.JsonWriter.Escaping", GA_TEST_FLAGS)
+
+bool FGAJsonWriterEscapingTest::RunTest(const FString& Parameters)
+{
+    FGAJsonWriter Writer;
+
+    const TCHAR Value[] = { '"', '\\', '\b', '\f', '\n', '\r', '\t', 0x01, 0x1F, 'a', '/' };
+    WriteStringObject(Writer, Value, 11);
+    TestTrue(TEXT("Quotes, backslashes and control characters are escaped"), ContentEquals(Writer, "{\"k\":\"\\\"\\\\\\b\\f\\n\\r\\t\\u0001\\u001fa/\"}"));
+
+    const TCHAR Multibyte[] = { 0x00E9, 0x20AC };
+    WriteStringObject(Writer, Multibyte, 2);
+    TestTrue(TEXT("Non ASCII characters are encoded as UTF-8"), ContentEquals(Writer, "{\"k\":\"\xC3\xA9\xE2\x82\xAC\"}"));
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGAJsonWriterSurrogatesTest, "GameAnalytics.JsonWriter.Surrogates", GA_TEST_FLAGS)
+
+bool FGAJsonWriterSurrogatesTest::RunTest(const FString& Parameters)
+{
+    FGAJsonWriter Writer;
+
+    const TCHAR Pair[] = { 0xD83D, 0xDE00 };
+    WriteStringObject(Writer, Pair, 2);
+    TestTrue(TEXT("A surrogate pair becomes one four byte sequence"), ContentEquals(Writer, "{\"k\":\"\xF0\x9F\x98\x80\"}"));
+
+    const TCHAR LoneHigh[] = { 0xD83D, 'a' };
+    WriteStringObject(Writer, LoneHigh, 2);
+    TestTrue(TEXT("A lone high surrogate becomes U+FFFD"), ContentEquals(Writer, "{\"k\":\"\xEF\xBF\xBD" "a\"}"));
+
+    const TCHAR LoneLow[] = { 0xDE00 };
+    WriteStringObject(Writer, LoneLow, 1);
+    TestTrue(TEXT("A lone low surrogate becomes U+FFFD"), ContentEquals(Writer, "{\"k\":\"\xEF\xBF\xBD\"}"));
+
+    // the low half is past Length
+    WriteStringObject(Writer, Pair, 1);
+    TestTrue(TEXT("A pair cut by the length becomes U+FFFD"), ContentEquals(Writer, "{\"k\":\"\xEF\xBF\xBD\"}"));
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGAJsonWriterRollbackTest, "GameAnalytics.JsonWriter.Rollback", GA_TEST_FLAGS)
+
+bool FGAJsonWriterRollbackTest::RunTest(const FString& Parameters)
+{
+    FGAJsonWriter Writer;
+
+    Writer.BeginObject();
+    Writer.WriteNumberMember(TEXT("a"), 1.0);
+    FGAJsonWriter::FMark Mark = Writer.GetMark();
+    Writer.WriteNumberMember(TEXT("b"), 2.5);
+    Writer.Rollback(Mark);
+    Writer.WriteNumberMember(TEXT("c"), 3.0);
+    Writer.EndObject();
+    TestTrue(TEXT("A rolled back member leaves no trace"), ContentEquals(Writer, "{\"a\":1,\"c\":3}"));
+
+    // rolling back the first member must also forget its separator state
+    Writer.Reset();
+    Writer.BeginObject();
+    Mark = Writer.GetMark();
+    Writer.WriteNumberMember(TEXT("a"), 1.0);
+    Writer.Rollback(Mark);
+    Writer.WriteNumberMember(TEXT("b"), 2.0);
+    Writer.EndObject();
+    TestTrue(TEXT("No separator after rolling back the first member"), ContentEquals(Writer, "{\"b\":2}"));
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGAJsonWriterValuesTest, "GameAnalytics.JsonWriter.Values", GA_TEST_FLAGS)
+
+bool FGAJsonWriterValuesTest::RunTest(const FString& Parameters)
+{
+    FGAJsonWriter Writer;
+
+    TArray<TSharedPtr<FJsonValue>> Array;
+    Array.Add(MakeShared<FJsonValueNumber>(1.0));
+    Array.Add(MakeShared<FJsonValueBoolean>(true));
+
+    Writer.BeginObject();
+    Writer.WriteMember(TEXT("n"), FJsonValueNumber(0.5));
+    Writer.WriteMember(TEXT("a"), FJsonValueArray(Array));
+    Writer.WriteMember(TEXT("z"), FJsonValueNull());
+    Writer.WriteNumberMember(TEXT("inf"), TNumericLimits<double>::Max() * 2.0);
+    Writer.EndObject();
+    TestTrue(TEXT("Numbers, arrays, null and non finite numbers"), ContentEquals(Writer, "{\"n\":0.5,\"a\":[1,true],\"z\":null,\"inf\":0}"));
+
+    return true;
+}
+
+#endif
@@ -0,0 +1,60 @@
+#include "GameAnalyticsTests.h"
+#include "GameAnalyticsProgressionTracker.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGAProgressionTrackerAttemptsTest, "GameAnalytics.ProgressionTracker.Attempts", GA_TEST_FLAGS)
+
+bool FGAProgressionTrackerAttemptsTest::RunTest(const FString& Parameters)
+{
+    FGAProgressionTracker Tracker;
+    FGAProgressionTracker::FTiming Timing;
+
+    TestFalse(TEXT("Nothing is tracked while disabled"), Tracker.Track(EGAProgressionStatus::start, "world", nullptr, nullptr, Timing));
+
+    Tracker.SetEnabled(true);
+    TestFalse(TEXT("A complete without a start has no timing"), Tracker.Track(EGAProgressionStatus::complete, "world", nullptr, nullptr, Timing));
+
+    TestFalse(TEXT("A start has no timing"), Tracker.Track(EGAProgressionStatus::start, "world", "level", nullptr, Timing));
+    TestTrue(TEXT("A fail matches its start"), Tracker.Track(EGAProgressionStatus::fail, "world", "level", nullptr, Timing));
+    TestEqual(TEXT("First attempt"), Timing.Attempt, 1);
+    TestTrue(TEXT("Elapsed time is not negative"), Timing.ElapsedSeconds >= 0.0);
+
+    TestFalse(TEXT("A second fail has no open start"), Tracker.Track(EGAProgressionStatus::fail, "world", "level", nullptr, Timing));
+
+    Tracker.Track(EGAProgressionStatus::start, "world", "level", nullptr, Timing);
+    TestTrue(TEXT("A complete matches its start"), Tracker.Track(EGAProgressionStatus::complete, "world", "level", nullptr, Timing));
+    TestEqual(TEXT("Attempts add up until the complete"), Timing.Attempt, 2);
+
+    Tracker.Track(EGAProgressionStatus::start, "world", "level", nullptr, Timing);
+    Tracker.Track(EGAProgressionStatus::complete, "world", "level", nullptr, Timing);
+    TestEqual(TEXT("A complete starts a new series of attempts"), Timing.Attempt, 1);
+
+    Tracker.SetEnabled(false);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGAProgressionTrackerPathsTest, "GameAnalytics.ProgressionTracker.Paths", GA_TEST_FLAGS)
+
+bool FGAProgressionTrackerPathsTest::RunTest(const FString& Parameters)
+{
+    FGAProgressionTracker Tracker;
+    FGAProgressionTracker::FTiming Timing;
+    Tracker.SetEnabled(true);
+
+    Tracker.Track(EGAProgressionStatus::start, "ab", nullptr, nullptr, Timing);
+    TestFalse(TEXT("Parts are not concatenated"), Tracker.Track(EGAProgressionStatus::complete, "a", "b", nullptr, Timing));
+    TestFalse(TEXT("A deeper path is another path"), Tracker.Track(EGAProgressionStatus::complete, "ab", "1", nullptr, Timing));
+    TestTrue(TEXT("The started path still matches"), Tracker.Track(EGAProgressionStatus::complete, "ab", nullptr, nullptr, Timing));
+
+    // disabling releases the table, nothing started before survives it
+    Tracker.Track(EGAProgressionStatus::start, "world", nullptr, nullptr, Timing);
+    Tracker.SetEnabled(false);
+    Tracker.SetEnabled(true);
+    TestFalse(TEXT("Disabling forgets the open starts"), Tracker.Track(EGAProgressionStatus::complete, "world", nullptr, nullptr, Timing));
+
+    Tracker.SetEnabled(false);
+    return true;
+}
+
+#endif
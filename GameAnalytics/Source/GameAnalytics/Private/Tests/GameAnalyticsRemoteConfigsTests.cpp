@@ -0,0 +1,86 @@
+#include "GameAnalyticsTests.h"
+#include "GameAnalyticsRemoteConfigs.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    const FGARemoteConfigs::FChange* FindChange(const TArray<FGARemoteConfigs::FChange>& Changes, const TCHAR* Key)
+    {
+        return Changes.FindByPredicate([Key](const FGARemoteConfigs::FChange& Change) { return Change.Key == Key; });
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGARemoteConfigsUpdateTest, "GameAnalytics.RemoteConfigs.Update", GA_TEST_FLAGS)
+
+bool FGARemoteConfigsUpdateTest::RunTest(const FString& Parameters)
+{
+    FGARemoteConfigs RemoteConfigs;
+    TArray<FGARemoteConfigs::FChange> Changes;
+
+    RemoteConfigs.Update(TEXT("{\"difficulty\":\"easy\",\"lives\":\"3\"}"), Changes);
+    TestEqual(TEXT("Every key of the first payload is added"), Changes.Num(), 2);
+    if (const FGARemoteConfigs::FChange* Added = FindChange(Changes, TEXT("difficulty")))
+    {
+        TestTrue(TEXT("An added key has no old value"), Added->OldValue.IsEmpty());
+        TestEqual(TEXT("An added key has its new value"), Added->NewValue, FString(TEXT("easy")));
+    }
+    else
+    {
+        AddError(TEXT("The added key is not reported"));
+    }
+
+    RemoteConfigs.Update(TEXT("{\"difficulty\":\"easy\",\"lives\":\"3\"}"), Changes);
+    TestEqual(TEXT("An unchanged payload reports nothing"), Changes.Num(), 0);
+
+    RemoteConfigs.Update(TEXT("{\"difficulty\":\"hard\",\"shop\":\"on\"}"), Changes);
+    TestEqual(TEXT("One change, one addition and one removal"), Changes.Num(), 3);
+    if (const FGARemoteConfigs::FChange* Changed = FindChange(Changes, TEXT("difficulty")))
+    {
+        TestEqual(TEXT("A changed key has its old value"), Changed->OldValue, FString(TEXT("easy")));
+        TestEqual(TEXT("A changed key has its new value"), Changed->NewValue, FString(TEXT("hard")));
+    }
+    else
+    {
+        AddError(TEXT("The changed key is not reported"));
+    }
+    if (const FGARemoteConfigs::FChange* Removed = FindChange(Changes, TEXT("lives")))
+    {
+        TestEqual(TEXT("A removed key has its old value"), Removed->OldValue, FString(TEXT("3")));
+        TestTrue(TEXT("A removed key has no new value"), Removed->NewValue.IsEmpty());
+    }
+    else
+    {
+        AddError(TEXT("The removed key is not reported"));
+    }
+
+    RemoteConfigs.Update(TEXT("not json"), Changes);
+    TestEqual(TEXT("An unparsable payload reports nothing"), Changes.Num(), 0);
+
+    // the snapshot survived the unparsable payload
+    RemoteConfigs.Update(TEXT("{\"difficulty\":\"hard\",\"shop\":\"on\"}"), Changes);
+    TestEqual(TEXT("The snapshot is kept across an unparsable payload"), Changes.Num(), 0);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGARemoteConfigsParseTest, "GameAnalytics.RemoteConfigs.ParseContent", GA_TEST_FLAGS)
+
+bool FGARemoteConfigsParseTest::RunTest(const FString& Parameters)
+{
+    TMap<FString, FString> Values;
+
+    TestFalse(TEXT("An empty payload fails"), FGARemoteConfigs::ParseContent(FString(), Values));
+    TestFalse(TEXT("An array payload fails"), FGARemoteConfigs::ParseContent(TEXT("[1,2]"), Values));
+
+    TestTrue(TEXT("An object payload parses"), FGARemoteConfigs::ParseContent(TEXT("{\"name\":\"value\",\"nested\":{\"a\":1}}"), Values));
+    TestEqual(TEXT("Both keys are read"), Values.Num(), 2);
+    const FString* Name = Values.Find(TEXT("name"));
+    TestTrue(TEXT("A string value is kept as is"), Name != nullptr && *Name == TEXT("value"));
+    const FString* Nested = Values.Find(TEXT("nested"));
+    TestTrue(TEXT("An object value keeps its JSON text"), Nested != nullptr && Nested->Contains(TEXT("\"a\"")));
+
+    return true;
+}
+
+#endif
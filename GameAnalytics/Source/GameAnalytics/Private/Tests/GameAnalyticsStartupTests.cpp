@@ -0,0 +1,61 @@
+#include "GameAnalyticsTests.h"
+#include "GameAnalyticsProvider.h"
+#include "UEGameAnalytics.h"
+#include "HAL/PlatformTime.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    struct FStartupTimes
+    {
+        /** Spent inside StartSession on the calling thread */
+        double StartSessionMs = 0.0;
+        /** Until the backend is initialized, equal to StartSessionMs without deferred initialization */
+        double InitializedMs = 0.0;
+    };
+
+    FStartupTimes TimeStartSession(bool bDeferred)
+    {
+        FAnalyticsGameAnalytics::FGameAnalyticsProjectSettings Settings = FAnalyticsGameAnalytics::LoadProjectSettings();
+        Settings.UseDeferredInitialization = bDeferred;
+
+        FStartupTimes Times;
+        FAnalyticsProviderGameAnalytics Provider;
+        const double StartTime = FPlatformTime::Seconds();
+        Provider.StartSessionWithSettings(Settings, TArray<FAnalyticsEventAttribute>());
+        Times.StartSessionMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+        // waits for a deferred initialization
+        Provider.FlushEvents();
+        Times.InitializedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+        return Times;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGAStartupTimeTest, "GameAnalytics.Startup.DeferredInitialization", GA_TEST_FLAGS)
+
+bool FGAStartupTimeTest::RunTest(const FString& Parameters)
+{
+    const int32 Runs = 5;
+    FStartupTimes Direct;
+    FStartupTimes Deferred;
+    for (int32 Run = 0; Run < Runs; ++Run)
+    {
+        // alternated, so a warm cache does not favour either path
+        const FStartupTimes DirectRun = TimeStartSession(false);
+        const FStartupTimes DeferredRun = TimeStartSession(true);
+        Direct.StartSessionMs += DirectRun.StartSessionMs / Runs;
+        Direct.InitializedMs += DirectRun.InitializedMs / Runs;
+        Deferred.StartSessionMs += DeferredRun.StartSessionMs / Runs;
+        Deferred.InitializedMs += DeferredRun.InitializedMs / Runs;
+    }
+
+    AddInfo(FString::Printf(TEXT("Direct initialization: StartSession %.3f ms, initialized after %.3f ms"), Direct.StartSessionMs, Direct.InitializedMs));
+    AddInfo(FString::Printf(TEXT("Deferred initialization: StartSession %.3f ms, initialized after %.3f ms"), Deferred.StartSessionMs, Deferred.InitializedMs));
+    TestTrue(TEXT("Deferred initialization completes after StartSession has returned"), Deferred.InitializedMs >= Deferred.StartSessionMs);
+
+    return true;
+}
+
+#endif
@@ -0,0 +1,48 @@
+#include "GameAnalyticsTests.h"
+#include "GameAnalyticsStringSink.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGAStringSinkUtf8Test, "GameAnalytics.StringSink.Utf8", GA_TEST_FLAGS)
+
+bool FGAStringSinkUtf8Test::RunTest(const FString& Parameters)
+{
+    FString Target = TEXT("previous content");
+    FGAFStringSink Sink(Target);
+
+    // only Length code units count, the data is not null terminated
+    const ANSICHAR Ascii[] = { 'a', 'b', 'c', 'x' };
+    Sink.SetUtf8(Ascii, 3);
+    TestEqual(TEXT("ASCII replaces the content"), Target, FString(TEXT("abc")));
+    TestEqual(TEXT("ASCII length"), Target.Len(), 3);
+
+    // e acute, euro sign and an emoji outside the BMP
+    const ANSICHAR Multibyte[] = { '\xC3', '\xA9', '\xE2', '\x82', '\xAC', '\xF0', '\x9F', '\x98', '\x80' };
+    Sink.SetUtf8(Multibyte, 9);
+    TestEqual(TEXT("Multibyte sequences are decoded"), Target, FString(TEXT("\u00E9\u20AC\U0001F600")));
+
+    Sink.SetUtf8(Ascii, 0);
+    TestTrue(TEXT("Zero length empties the string"), Target.IsEmpty());
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGAStringSinkUtf16Test, "GameAnalytics.StringSink.Utf16", GA_TEST_FLAGS)
+
+bool FGAStringSinkUtf16Test::RunTest(const FString& Parameters)
+{
+    FString Target = TEXT("previous content");
+    FGAFStringSink Sink(Target);
+
+    // a surrogate pair stays one character, the trailing unit is past Length
+    const UTF16CHAR Chars[] = { 'h', 'i', 0x00E9, 0xD83D, 0xDE00, 'z' };
+    Sink.SetUtf16(Chars, 5);
+    TestEqual(TEXT("UTF-16 is decoded"), Target, FString(TEXT("hi\u00E9\U0001F600")));
+
+    Sink.SetUtf16(Chars, 0);
+    TestTrue(TEXT("Zero length empties the string"), Target.IsEmpty());
+
+    return true;
+}
+
+#endif
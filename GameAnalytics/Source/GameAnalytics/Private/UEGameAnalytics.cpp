@@ -3,6 +3,9 @@
 #include "Interfaces/IAnalyticsProvider.h"
 #include "GameAnalyticsProvider.h"
 #include "GameAnalytics.h"
+#include "GameAnalyticsEventStaging.h"
+#include "GameAnalyticsStats.h"
+#include "Async/Async.h"
 
 #if GA_USE_CPP_SDK
     #if PLATFORM_WINDOWS
@@ -17,23 +20,79 @@
 
 IMPLEMENT_MODULE( FAnalyticsGameAnalytics, GameAnalytics )
 
-static const TMap<FString, EGAProgressionStatus> k_ProgressionStrings =
+#if PLATFORM_IOS || PLATFORM_ANDROID
+// Seconds between two remote config change checks on the mobile SDKs
+static const float RemoteConfigsPollInterval = 5.0f;
+#endif
+
+DECLARE_CYCLE_STAT(TEXT("StartSession"), STAT_GameAnalytics_StartSession, STATGROUP_GameAnalytics);
+
+/**
+* Maps a RecordProgress type to its status. FName lookups ignore case, so the type is neither lowercased nor copied
+*/
+static bool FindProgressionStatus(const FString& ProgressType, EGAProgressionStatus& OutStatus)
 {
-    {TEXT("start"),    EGAProgressionStatus::start},
-    {TEXT("complete"), EGAProgressionStatus::complete},
-    {TEXT("fail"),     EGAProgressionStatus::fail}
-};
+    static const TMap<FName, EGAProgressionStatus> ProgressionStatuses =
+    {
+        {FName(TEXT("start")),    EGAProgressionStatus::start},
+        {FName(TEXT("complete")), EGAProgressionStatus::complete},
+        {FName(TEXT("fail")),     EGAProgressionStatus::fail}
+    };
+
+    // FNAME_Find does not add unknown types to the name table
+    const EGAProgressionStatus* Status = ProgressionStatuses.Find(FName(*ProgressType, FNAME_Find));
+    if (Status == nullptr)
+    {
+        UE_LOG(LogGameAnalyticsAnalytics, Warning, TEXT("RecordProgress: ProgressType value must be either start, complete or fail. ProgressType=%s"), *ProgressType);
+        return false;
+    }
+
+    OutStatus = *Status;
+    return true;
+}
 
 void FAnalyticsGameAnalytics::StartupModule()
 {
     UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("FAnalyticsGameAnalytics Constructor"));
     GameAnalyticsProvider = MakeShareable(new FAnalyticsProviderGameAnalytics());
+
+#if ENGINE_MAJOR_VERSION >= 5
+    StagingTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FAnalyticsGameAnalytics::TickStagedEvents));
+#else
+    StagingTickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FAnalyticsGameAnalytics::TickStagedEvents));
+#endif
+
+#if PLATFORM_IOS || PLATFORM_ANDROID
+#if ENGINE_MAJOR_VERSION >= 5
+    RemoteConfigsTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FAnalyticsGameAnalytics::TickRemoteConfigs), RemoteConfigsPollInterval);
+#else
+    RemoteConfigsTickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FAnalyticsGameAnalytics::TickRemoteConfigs), RemoteConfigsPollInterval);
+#endif
+#endif
 }
 
 void FAnalyticsGameAnalytics::ShutdownModule()
 {
+#if ENGINE_MAJOR_VERSION >= 5
+    FTSTicker::GetCoreTicker().RemoveTicker(StagingTickerHandle);
+#else
+    FTicker::GetCoreTicker().RemoveTicker(StagingTickerHandle);
+#endif
+#if PLATFORM_IOS || PLATFORM_ANDROID
+#if ENGINE_MAJOR_VERSION >= 5
+    FTSTicker::GetCoreTicker().RemoveTicker(RemoteConfigsTickerHandle);
+#else
+    FTicker::GetCoreTicker().RemoveTicker(RemoteConfigsTickerHandle);
+#endif
+#endif
+    // the bridge thread raises events, it has to be gone before they are flushed
+    UGameAnalytics::setEnabledLogBridge(false);
+
     if (GameAnalyticsProvider.IsValid())
     {
+        // also waits for a deferred initialization, so held back events are not dropped
+        GameAnalyticsProvider->FlushEvents();
+
         UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("FAnalyticsGameAnalytics Destructor"));
 #if GA_USE_CPP_SDK
         UGameAnalytics::onQuit();
@@ -41,6 +100,22 @@ void FAnalyticsGameAnalytics::ShutdownModule()
     }
 }
 
+bool FAnalyticsGameAnalytics::TickStagedEvents(float DeltaTime)
+{
+    UGameAnalytics::tickStagedEvents();
+    return true;
+}
+
+bool FAnalyticsGameAnalytics::TickRemoteConfigs(float DeltaTime)
+{
+    // only diff while someone listens, the payload is fetched and compared as a whole
+    if ((UGameAnalytics::OnRemoteConfigKeyChanged.IsBound() || UGameAnalytics::OnABTestingAssignmentChanged.IsBound()) && UGameAnalytics::isRemoteConfigsReady())
+    {
+        UGameAnalytics::checkRemoteConfigsForChanges();
+    }
+    return true;
+}
+
 #if (ENGINE_MAJOR_VERSION >= 4 && ENGINE_MINOR_VERSION >= 13) || (ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 0)
 TSharedPtr<IAnalyticsProvider> FAnalyticsGameAnalytics::CreateAnalyticsProvider(const FAnalyticsProviderConfigurationDelegate& GetConfigValue) const
 {
@@ -54,121 +129,172 @@ TSharedPtr<IAnalyticsProvider> FAnalyticsGameAnalytics::CreateAnalyticsProvider(
 #endif
 
 
-FAnalyticsGameAnalytics::FGameAnalyticsProjectSettings FAnalyticsGameAnalytics::LoadProjectSettings()
-{
-    FGameAnalyticsProjectSettings Settings;
+// Set by GameAnalytics.Build.cs when the project settings are baked into the binary
+#ifndef GA_BAKED_SETTINGS
+#define GA_BAKED_SETTINGS 0
+#endif
 
-    if (!GConfig) return Settings;
+#if !GA_BAKED_SETTINGS
+static const TCHAR* GameAnalyticsSettingsSection = TEXT("/Script/GameAnalyticsEditor.GameAnalyticsProjectSettings");
 
-    if(!GConfig->GetString(TEXT("/Script/GameAnalyticsEditor.GameAnalyticsProjectSettings"), TEXT("AndroidGameKey"), Settings.AndroidGameKey, GetIniName()))
-    {
-        Settings.AndroidGameKey = "";
-    }
-    if(!GConfig->GetString(TEXT("/Script/GameAnalyticsEditor.GameAnalyticsProjectSettings"), TEXT("AndroidSecretKey"), Settings.AndroidSecretKey, GetIniName()))
-    {
-        Settings.AndroidSecretKey = "";
-    }
-    if(!GConfig->GetString(TEXT("/Script/GameAnalyticsEditor.GameAnalyticsProjectSettings"), TEXT("AndroidBuild"), Settings.AndroidBuild, GetIniName()))
+static bool ReadSetting(const FConfigSection* Section, const TCHAR* Key, FString& Value)
+{
+    const FConfigValue* ConfigValue = Section->Find(FName(Key));
+    if (ConfigValue == nullptr)
     {
-        Settings.AndroidBuild = "0.1";
+        return false;
     }
+    Value = ConfigValue->GetValue();
+    return true;
+}
 
-    if(!GConfig->GetString(TEXT("/Script/GameAnalyticsEditor.GameAnalyticsProjectSettings"), TEXT("IosGameKey"), Settings.IosGameKey, GetIniName()))
-    {
-        Settings.IosGameKey = "";
-    }
-    if(!GConfig->GetString(TEXT("/Script/GameAnalyticsEditor.GameAnalyticsProjectSettings"), TEXT("IosSecretKey"), Settings.IosSecretKey, GetIniName()))
-    {
-        Settings.IosSecretKey = "";
-    }
-    if(!GConfig->GetString(TEXT("/Script/GameAnalyticsEditor.GameAnalyticsProjectSettings"), TEXT("IosBuild"), Settings.IosBuild, GetIniName()))
+static bool ReadSetting(const FConfigSection* Section, const TCHAR* Key, bool& Value)
+{
+    const FConfigValue* ConfigValue = Section->Find(FName(Key));
+    if (ConfigValue == nullptr)
     {
-        Settings.IosBuild = "0.1";
+        return false;
     }
+    Value = FCString::ToBool(*ConfigValue->GetValue());
+    return true;
+}
 
-    if(!GConfig->GetString(TEXT("/Script/GameAnalyticsEditor.GameAnalyticsProjectSettings"), TEXT("MacGameKey"), Settings.MacGameKey, GetIniName()))
-    {
-        Settings.MacGameKey = "";
-    }
-    if(!GConfig->GetString(TEXT("/Script/GameAnalyticsEditor.GameAnalyticsProjectSettings"), TEXT("MacSecretKey"), Settings.MacSecretKey, GetIniName()))
-    {
-        Settings.MacSecretKey = "";
-    }
-    if(!GConfig->GetString(TEXT("/Script/GameAnalyticsEditor.GameAnalyticsProjectSettings"), TEXT("MacBuild"), Settings.MacBuild, GetIniName()))
-    {
-        Settings.MacBuild = "0.1";
-    }
+static void ReadSetting(const FConfigSection* Section, const TCHAR* Key, TArray<FString>& Values)
+{
+    // Array entries are stored as "+Key" by the settings editor, older files may use the plain key
+    TArray<FConfigValue> ConfigValues;
+    Section->MultiFind(FName(*FString::Printf(TEXT("+%s"), Key)), ConfigValues, true);
+    Section->MultiFind(FName(Key), ConfigValues, true);
 
-    if(!GConfig->GetString(TEXT("/Script/GameAnalyticsEditor.GameAnalyticsProjectSettings"), TEXT("WindowsGameKey"), Settings.WindowsGameKey, GetIniName()))
-    {
-        Settings.WindowsGameKey = "";
-    }
-    if(!GConfig->GetString(TEXT("/Script/GameAnalyticsEditor.GameAnalyticsProjectSettings"), TEXT("WindowsSecretKey"), Settings.WindowsSecretKey, GetIniName()))
+    Values.Reset(ConfigValues.Num());
+    for (const FConfigValue& ConfigValue : ConfigValues)
     {
-        Settings.WindowsSecretKey = "";
-    }
-    if(!GConfig->GetString(TEXT("/Script/GameAnalyticsEditor.GameAnalyticsProjectSettings"), TEXT("WindowsBuild"), Settings.WindowsBuild, GetIniName()))
-    {
-        Settings.WindowsBuild = "0.1";
+        Values.Add(ConfigValue.GetValue());
     }
+}
+#endif
 
-    if (!GConfig->GetString(TEXT("/Script/GameAnalyticsEditor.GameAnalyticsProjectSettings"), TEXT("LinuxGameKey"), Settings.LinuxGameKey, GetIniName()))
-    {
-        Settings.LinuxGameKey = "";
-    }
-    if (!GConfig->GetString(TEXT("/Script/GameAnalyticsEditor.GameAnalyticsProjectSettings"), TEXT("LinuxSecretKey"), Settings.LinuxSecretKey, GetIniName()))
-    {
-        Settings.LinuxSecretKey = "";
-    }
-    if (!GConfig->GetString(TEXT("/Script/GameAnalyticsEditor.GameAnalyticsProjectSettings"), TEXT("LinuxBuild"), Settings.LinuxBuild, GetIniName()))
-    {
-        Settings.LinuxBuild = "0.1";
-    }
+FAnalyticsGameAnalytics::FGameAnalyticsProjectSettings FAnalyticsGameAnalytics::ReadProjectSettings()
+{
+    FGameAnalyticsProjectSettings Settings;
+    Settings.IosBuild = Settings.AndroidBuild = Settings.MacBuild = Settings.WindowsBuild = Settings.LinuxBuild = Settings.Html5Build = TEXT("0.1");
+    Settings.UseManualSessionHandling = false;
+    Settings.AutoDetectAppVersion = false;
+    Settings.DisableDeviceInfo = false;
+    Settings.UseErrorReporting = true;
+    Settings.SubmitErrors = true;
+    Settings.SubmitAverageFPS = true;
+    Settings.SubmitCriticalFPS = true;
+    Settings.InfoLogEditor = true;
+    Settings.InfoLogBuild = true;
+    Settings.VerboseLogBuild = false;
 
-    if (!GConfig->GetString(TEXT("/Script/GameAnalyticsEditor.GameAnalyticsProjectSettings"), TEXT("Html5GameKey"), Settings.Html5GameKey, GetIniName()))
-    {
-        Settings.Html5GameKey = "";
-    }
-    if (!GConfig->GetString(TEXT("/Script/GameAnalyticsEditor.GameAnalyticsProjectSettings"), TEXT("Html5SecretKey"), Settings.Html5SecretKey, GetIniName()))
-    {
-        Settings.Html5SecretKey = "";
-    }
-    if (!GConfig->GetString(TEXT("/Script/GameAnalyticsEditor.GameAnalyticsProjectSettings"), TEXT("Html5Build"), Settings.Html5Build, GetIniName()))
-    {
-        Settings.Html5Build = "0.1";
-    }
+#if PLATFORM_IOS
+    FString& GameKey = Settings.IosGameKey;
+    FString& SecretKey = Settings.IosSecretKey;
+    FString& Build = Settings.IosBuild;
+#elif PLATFORM_ANDROID
+    FString& GameKey = Settings.AndroidGameKey;
+    FString& SecretKey = Settings.AndroidSecretKey;
+    FString& Build = Settings.AndroidBuild;
+#elif PLATFORM_MAC
+    FString& GameKey = Settings.MacGameKey;
+    FString& SecretKey = Settings.MacSecretKey;
+    FString& Build = Settings.MacBuild;
+#elif PLATFORM_WINDOWS
+    FString& GameKey = Settings.WindowsGameKey;
+    FString& SecretKey = Settings.WindowsSecretKey;
+    FString& Build = Settings.WindowsBuild;
+#else
+    FString& GameKey = Settings.LinuxGameKey;
+    FString& SecretKey = Settings.LinuxSecretKey;
+    FString& Build = Settings.LinuxBuild;
+#endif
 
-    if(!GConfig->GetBool(TEXT("/Script/GameAnalyticsEditor.GameAnalyticsProjectSettings"), TEXT("UseManualSessionHandling"), Settings.UseManualSessionHandling, GetIniName()))
-    {
-        Settings.UseManualSessionHandling = false;
-    }
-    if(!GConfig->GetBool(TEXT("/Script/GameAnalyticsEditor.GameAnalyticsProjectSettings"), TEXT("AutoDetectAppVersion"), Settings.AutoDetectAppVersion, GetIniName()))
-    {
-        Settings.AutoDetectAppVersion = false;
-    }
-    if (!GConfig->GetBool(TEXT("/Script/GameAnalyticsEditor.GameAnalyticsProjectSettings"), TEXT("DisableDeviceInfo"), Settings.DisableDeviceInfo, GetIniName()))
-    {
-        Settings.DisableDeviceInfo = false;
-    }
-    if (!GConfig->GetBool(TEXT("/Script/GameAnalyticsEditor.GameAnalyticsProjectSettings"), TEXT("UseErrorReporting"), Settings.UseErrorReporting, GetIniName()))
-    {
-        Settings.UseErrorReporting = true;
-    }
-    if(!GConfig->GetBool(TEXT("/Script/GameAnalyticsEditor.GameAnalyticsProjectSettings"), TEXT("InfoLogBuild"), Settings.InfoLogBuild, GetIniName()))
-    {
-        Settings.InfoLogBuild = true;
-    }
-    if(!GConfig->GetBool(TEXT("/Script/GameAnalyticsEditor.GameAnalyticsProjectSettings"), TEXT("VerboseLogBuild"), Settings.VerboseLogBuild, GetIniName()))
+#if GA_BAKED_SETTINGS
+    // Written into the binary by GameAnalytics.Build.cs, no config file is touched at startup
+    GameKey = TEXT(GA_BAKED_GAME_KEY);
+    SecretKey = TEXT(GA_BAKED_SECRET_KEY);
+    Build = TEXT(GA_BAKED_BUILD);
+    Settings.UseManualSessionHandling = GA_BAKED_USE_MANUAL_SESSION_HANDLING != 0;
+    Settings.AutoDetectAppVersion = GA_BAKED_AUTO_DETECT_APP_VERSION != 0;
+    Settings.DisableDeviceInfo = GA_BAKED_DISABLE_DEVICE_INFO != 0;
+    Settings.UseErrorReporting = GA_BAKED_USE_ERROR_REPORTING != 0;
+    Settings.RecordEventAsSingleDesignEvent = GA_BAKED_RECORD_EVENT_AS_SINGLE_DESIGN_EVENT != 0;
+    Settings.UseDeferredInitialization = GA_BAKED_USE_DEFERRED_INITIALIZATION != 0;
+    Settings.InfoLogBuild = GA_BAKED_INFO_LOG_BUILD != 0;
+    Settings.VerboseLogBuild = GA_BAKED_VERBOSE_LOG_BUILD != 0;
+    Settings.CustomDimensions01 = TArray<FString>{ GA_BAKED_CUSTOM_DIMENSIONS_01 };
+    Settings.CustomDimensions02 = TArray<FString>{ GA_BAKED_CUSTOM_DIMENSIONS_02 };
+    Settings.CustomDimensions03 = TArray<FString>{ GA_BAKED_CUSTOM_DIMENSIONS_03 };
+    Settings.ResourceCurrencies = TArray<FString>{ GA_BAKED_RESOURCE_CURRENCIES };
+    Settings.ResourceItemTypes = TArray<FString>{ GA_BAKED_RESOURCE_ITEM_TYPES };
+#else
+    // Read the file once and resolve the section once, instead of a GConfig lookup per key
+    FConfigFile ConfigFile;
+    ConfigFile.Read(GetIniName());
+
+#if (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4)
+    const FConfigSection* Section = ConfigFile.FindSection(GameAnalyticsSettingsSection);
+#else
+    const FConfigSection* Section = ConfigFile.Find(GameAnalyticsSettingsSection);
+#endif
+    if (Section == nullptr)
     {
-        Settings.VerboseLogBuild = false;
+        return Settings;
     }
 
-    GConfig->GetArray(TEXT("/Script/GameAnalyticsEditor.GameAnalyticsProjectSettings"), TEXT("+CustomDimensions01"), Settings.CustomDimensions01, GetIniName());
-    GConfig->GetArray(TEXT("/Script/GameAnalyticsEditor.GameAnalyticsProjectSettings"), TEXT("+CustomDimensions02"), Settings.CustomDimensions02, GetIniName());
-    GConfig->GetArray(TEXT("/Script/GameAnalyticsEditor.GameAnalyticsProjectSettings"), TEXT("+CustomDimensions03"), Settings.CustomDimensions03, GetIniName());
-    GConfig->GetArray(TEXT("/Script/GameAnalyticsEditor.GameAnalyticsProjectSettings"), TEXT("+ResourceCurrencies"), Settings.ResourceCurrencies, GetIniName());
-    GConfig->GetArray(TEXT("/Script/GameAnalyticsEditor.GameAnalyticsProjectSettings"), TEXT("+ResourceItemTypes"), Settings.ResourceItemTypes, GetIniName());
+    // Only the keys of the platform we are running on
+#if PLATFORM_IOS
+    ReadSetting(Section, TEXT("IosGameKey"), GameKey);
+    ReadSetting(Section, TEXT("IosSecretKey"), SecretKey);
+    ReadSetting(Section, TEXT("IosBuild"), Build);
+#elif PLATFORM_ANDROID
+    ReadSetting(Section, TEXT("AndroidGameKey"), GameKey);
+    ReadSetting(Section, TEXT("AndroidSecretKey"), SecretKey);
+    ReadSetting(Section, TEXT("AndroidBuild"), Build);
+#elif PLATFORM_MAC
+    ReadSetting(Section, TEXT("MacGameKey"), GameKey);
+    ReadSetting(Section, TEXT("MacSecretKey"), SecretKey);
+    ReadSetting(Section, TEXT("MacBuild"), Build);
+#elif PLATFORM_WINDOWS
+    ReadSetting(Section, TEXT("WindowsGameKey"), GameKey);
+    ReadSetting(Section, TEXT("WindowsSecretKey"), SecretKey);
+    ReadSetting(Section, TEXT("WindowsBuild"), Build);
+#else
+    ReadSetting(Section, TEXT("LinuxGameKey"), GameKey);
+    ReadSetting(Section, TEXT("LinuxSecretKey"), SecretKey);
+    ReadSetting(Section, TEXT("LinuxBuild"), Build);
+#endif
+
+    ReadSetting(Section, TEXT("UseManualSessionHandling"), Settings.UseManualSessionHandling);
+    ReadSetting(Section, TEXT("AutoDetectAppVersion"), Settings.AutoDetectAppVersion);
+    ReadSetting(Section, TEXT("DisableDeviceInfo"), Settings.DisableDeviceInfo);
+    ReadSetting(Section, TEXT("UseErrorReporting"), Settings.UseErrorReporting);
+    ReadSetting(Section, TEXT("RecordEventAsSingleDesignEvent"), Settings.RecordEventAsSingleDesignEvent);
+    ReadSetting(Section, TEXT("UseDeferredInitialization"), Settings.UseDeferredInitialization);
+    ReadSetting(Section, TEXT("InfoLogBuild"), Settings.InfoLogBuild);
+    ReadSetting(Section, TEXT("VerboseLogBuild"), Settings.VerboseLogBuild);
+
+    ReadSetting(Section, TEXT("CustomDimensions01"), Settings.CustomDimensions01);
+    ReadSetting(Section, TEXT("CustomDimensions02"), Settings.CustomDimensions02);
+    ReadSetting(Section, TEXT("CustomDimensions03"), Settings.CustomDimensions03);
+    ReadSetting(Section, TEXT("ResourceCurrencies"), Settings.ResourceCurrencies);
+    ReadSetting(Section, TEXT("ResourceItemTypes"), Settings.ResourceItemTypes);
+#endif
+
+    return Settings;
+}
 
+const FAnalyticsGameAnalytics::FGameAnalyticsProjectSettings& FAnalyticsGameAnalytics::LoadProjectSettings()
+{
+#if WITH_EDITOR
+    // Settings can be edited while the editor is running, always pick up the saved values
+    static FGameAnalyticsProjectSettings Settings;
+    Settings = ReadProjectSettings();
+#else
+    static const FGameAnalyticsProjectSettings Settings = ReadProjectSettings();
+#endif
     return Settings;
 }
 
@@ -219,6 +345,7 @@ FAnalyticsProviderGameAnalytics::FAnalyticsProviderGameAnalytics() :
 FAnalyticsProviderGameAnalytics::~FAnalyticsProviderGameAnalytics()
 {
     UE_LOG(LogGameAnalyticsAnalytics, Display, TEXT("FAnalyticsGameAnalytics ~FAnalyticsProviderGameAnalytics"));
+    WaitForDeferredInitialization();
 }
 #if (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4)
 void FAnalyticsProviderGameAnalytics::SetDefaultEventAttributes(TArray<FAnalyticsEventAttribute>&& Attributes)
@@ -241,189 +368,207 @@ FAnalyticsEventAttribute FAnalyticsProviderGameAnalytics::GetDefaultEventAttribu
 }
 #endif
 
-bool FAnalyticsProviderGameAnalytics::StartSession(const TArray<FAnalyticsEventAttribute>& Attributes)
+FGAConfiguration FAnalyticsProviderGameAnalytics::BuildConfiguration(const TArray<FAnalyticsEventAttribute>& Attributes) const
 {
-    if(!bHasSessionStarted)
-    {
-        ProjectSettings = FAnalyticsGameAnalytics::LoadProjectSettings();
+    FGAConfiguration Configuration;
 
-#if WITH_EDITOR
-#elif GA_USE_CPP_SDK
 #if (ENGINE_MAJOR_VERSION >= 4 && ENGINE_MINOR_VERSION >= 18) || (ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 0)
-        gameanalytics::GameAnalytics::configureWritablePath(TCHAR_TO_UTF8(*FPaths::ProjectSavedDir()));
+    Configuration.WritablePath = FPaths::ProjectSavedDir();
 #else
-        gameanalytics::GameAnalytics::configureWritablePath(TCHAR_TO_UTF8(*FPaths::GameSavedDir()));
-#endif
+    Configuration.WritablePath = FPaths::GameSavedDir();
 #endif
 
-        ////// Enable log
-        UGameAnalytics::setEnabledInfoLog(ProjectSettings.InfoLogBuild);
-        UGameAnalytics::setEnabledVerboseLog(ProjectSettings.VerboseLogBuild);
-
-        if(ProjectSettings.AutoDetectAppVersion)
-        {
-            UGameAnalytics::configureAutoDetectAppVersion(ProjectSettings.AutoDetectAppVersion);
-        }
-
-        if (ProjectSettings.DisableDeviceInfo)
-        {
-            UGameAnalytics::disableDeviceInfo();
-        }
+    Configuration.bInfoLog = ProjectSettings.InfoLogBuild;
+    Configuration.bVerboseLog = ProjectSettings.VerboseLogBuild;
+    Configuration.bAutoDetectAppVersion = ProjectSettings.AutoDetectAppVersion;
+    Configuration.bDisableDeviceInfo = ProjectSettings.DisableDeviceInfo;
+    Configuration.bUseManualSessionHandling = ProjectSettings.UseManualSessionHandling;
+    Configuration.bUseErrorReporting = ProjectSettings.UseErrorReporting;
 
-        //// Configure build version
 #if PLATFORM_IOS
-        if(!ProjectSettings.AutoDetectAppVersion)
-        {
-            UGameAnalytics::configureBuild(TCHAR_TO_UTF8(*ProjectSettings.IosBuild));
-        }
+    Configuration.Build = ProjectSettings.IosBuild;
 #elif PLATFORM_ANDROID
-        if(!ProjectSettings.AutoDetectAppVersion)
-        {
-            UGameAnalytics::configureBuild(TCHAR_TO_UTF8(*ProjectSettings.AndroidBuild));
-        }
+    Configuration.Build = ProjectSettings.AndroidBuild;
 #elif PLATFORM_MAC
-        UGameAnalytics::configureBuild(TCHAR_TO_UTF8(*ProjectSettings.MacBuild));
+    Configuration.Build = ProjectSettings.MacBuild;
 #elif PLATFORM_WINDOWS
-        UGameAnalytics::configureBuild(TCHAR_TO_UTF8(*ProjectSettings.WindowsBuild));
+    Configuration.Build = ProjectSettings.WindowsBuild;
 #elif PLATFORM_LINUX
-        UGameAnalytics::configureBuild(TCHAR_TO_UTF8(*ProjectSettings.LinuxBuild));
+    Configuration.Build = ProjectSettings.LinuxBuild;
 // // #elif PLATFORM_HTML5
-//         UGameAnalytics::configureBuild(TCHAR_TO_UTF8(*ProjectSettings.Html5Build));
+//     Configuration.Build = ProjectSettings.Html5Build;
 #endif
 
-        ////// Configure available virtual currencies and item types
-        if (ProjectSettings.ResourceCurrencies.Num() > 0)
-        {
-            UGameAnalytics::configureAvailableResourceCurrencies(ProjectSettings.ResourceCurrencies);
-        }
-
-        if (ProjectSettings.ResourceItemTypes.Num() > 0)
-        {
-            UGameAnalytics::configureAvailableResourceItemTypes(ProjectSettings.ResourceItemTypes);
-        }
-
-        // Configure available custom dimensions
-        if (ProjectSettings.CustomDimensions01.Num() > 0)
-        {
-            UGameAnalytics::configureAvailableCustomDimensions01(ProjectSettings.CustomDimensions01);
-        }
-
-        if (ProjectSettings.CustomDimensions02.Num() > 0)
-        {
-            UGameAnalytics::configureAvailableCustomDimensions02(ProjectSettings.CustomDimensions02);
-        }
-
-        if (ProjectSettings.CustomDimensions03.Num() > 0)
-        {
-            UGameAnalytics::configureAvailableCustomDimensions03(ProjectSettings.CustomDimensions03);
-        }
-
-        if(ProjectSettings.UseManualSessionHandling)
-        {
-            UGameAnalytics::setEnabledManualSessionHandling(ProjectSettings.UseManualSessionHandling);
-        }
-
-        UGameAnalytics::setEnabledErrorReporting(ProjectSettings.UseErrorReporting);
+    Configuration.ResourceCurrencies = ProjectSettings.ResourceCurrencies;
+    Configuration.ResourceItemTypes = ProjectSettings.ResourceItemTypes;
+    Configuration.CustomDimensions01 = ProjectSettings.CustomDimensions01;
+    Configuration.CustomDimensions02 = ProjectSettings.CustomDimensions02;
+    Configuration.CustomDimensions03 = ProjectSettings.CustomDimensions03;
 
-        const int32 AttrCount = Attributes.Num();
-        FString gameKey;
-        FString secretKey;
-        if (AttrCount > 0)
+    const int32 AttrCount = Attributes.Num();
+    if (AttrCount > 0)
+    {
+        for (const FAnalyticsEventAttribute& Attr : Attributes)
         {
-            for (auto Attr : Attributes)
-            {
 #if PLATFORM_IOS
-                if (Attr.GetName() == TEXT("ios_gameKey"))
-                {
-                    gameKey = Attr.GetValue();
-                }
-                else if (Attr.GetName() == TEXT("ios_secretKey"))
-                {
-                    secretKey = Attr.GetValue();
-                }
+            if (Attr.GetName() == TEXT("ios_gameKey"))
+            {
+                Configuration.GameKey = Attr.GetValue();
+            }
+            else if (Attr.GetName() == TEXT("ios_secretKey"))
+            {
+                Configuration.SecretKey = Attr.GetValue();
+            }
 #elif PLATFORM_ANDROID
-                if (Attr.GetName() == TEXT("android_gameKey"))
-                {
-                    gameKey = Attr.GetValue();
-                }
-                else if (Attr.GetName() == TEXT("android_secretKey"))
-                {
-                    secretKey = Attr.GetValue();
-                }
+            if (Attr.GetName() == TEXT("android_gameKey"))
+            {
+                Configuration.GameKey = Attr.GetValue();
+            }
+            else if (Attr.GetName() == TEXT("android_secretKey"))
+            {
+                Configuration.SecretKey = Attr.GetValue();
+            }
 #elif PLATFORM_MAC
-                if (Attr.GetName() == TEXT("mac_gameKey"))
-                {
-                    gameKey = Attr.GetValue();
-                }
-                else if (Attr.GetName() == TEXT("mac_secretKey"))
-                {
-                    secretKey = Attr.GetValue();
-                }
+            if (Attr.GetName() == TEXT("mac_gameKey"))
+            {
+                Configuration.GameKey = Attr.GetValue();
+            }
+            else if (Attr.GetName() == TEXT("mac_secretKey"))
+            {
+                Configuration.SecretKey = Attr.GetValue();
+            }
 #elif PLATFORM_WINDOWS
-                if (Attr.GetName() == TEXT("windows_gameKey"))
-                {
-                    gameKey = Attr.GetValue();
-                }
-                else if (Attr.GetName() == TEXT("windows_secretKey"))
-                {
-                    secretKey = Attr.GetValue();
-                }
+            if (Attr.GetName() == TEXT("windows_gameKey"))
+            {
+                Configuration.GameKey = Attr.GetValue();
+            }
+            else if (Attr.GetName() == TEXT("windows_secretKey"))
+            {
+                Configuration.SecretKey = Attr.GetValue();
+            }
 #elif PLATFORM_LINUX
-                if (Attr.GetName() == TEXT("linux_gameKey"))
-                {
-                    gameKey = Attr.GetValue();
-                }
-                else if (Attr.GetName() == TEXT("linux_secretKey"))
-                {
-                    secretKey = Attr.GetValue();
-                }
+            if (Attr.GetName() == TEXT("linux_gameKey"))
+            {
+                Configuration.GameKey = Attr.GetValue();
+            }
+            else if (Attr.GetName() == TEXT("linux_secretKey"))
+            {
+                Configuration.SecretKey = Attr.GetValue();
+            }
 // // #elif PLATFORM_HTML5
-//                 if (Attr.GetName() == TEXT("html5_gameKey"))
-//                 {
-//                     gameKey = Attr.GetValue();
-//                 }
-//                 else if (Attr.GetName() == TEXT("html5_secretKey"))
-//                 {
-//                     secretKey = Attr.GetValue();
-//                 }
+//             if (Attr.GetName() == TEXT("html5_gameKey"))
+//             {
+//                 Configuration.GameKey = Attr.GetValue();
+//             }
+//             else if (Attr.GetName() == TEXT("html5_secretKey"))
+//             {
+//                 Configuration.SecretKey = Attr.GetValue();
+//             }
 #endif
-            }
         }
-        else
-        {
+    }
+    else
+    {
 #if PLATFORM_IOS
-            gameKey = ProjectSettings.IosGameKey;
-            secretKey = ProjectSettings.IosSecretKey;
+        Configuration.GameKey = ProjectSettings.IosGameKey;
+        Configuration.SecretKey = ProjectSettings.IosSecretKey;
 #elif PLATFORM_ANDROID
-            gameKey = ProjectSettings.AndroidGameKey;
-            secretKey = ProjectSettings.AndroidSecretKey;
+        Configuration.GameKey = ProjectSettings.AndroidGameKey;
+        Configuration.SecretKey = ProjectSettings.AndroidSecretKey;
 #elif PLATFORM_MAC
-            gameKey = ProjectSettings.MacGameKey;
-            secretKey = ProjectSettings.MacSecretKey;
+        Configuration.GameKey = ProjectSettings.MacGameKey;
+        Configuration.SecretKey = ProjectSettings.MacSecretKey;
 #elif PLATFORM_WINDOWS
-            gameKey = ProjectSettings.WindowsGameKey;
-            secretKey = ProjectSettings.WindowsSecretKey;
+        Configuration.GameKey = ProjectSettings.WindowsGameKey;
+        Configuration.SecretKey = ProjectSettings.WindowsSecretKey;
 #elif PLATFORM_LINUX
-            gameKey = ProjectSettings.LinuxGameKey;
-            secretKey = ProjectSettings.LinuxSecretKey;
+        Configuration.GameKey = ProjectSettings.LinuxGameKey;
+        Configuration.SecretKey = ProjectSettings.LinuxSecretKey;
 // // #elif PLATFORM_HTML5
-//             gameKey = ProjectSettings.Html5GameKey;
-//             secretKey = ProjectSettings.Html5SecretKey;
+//         Configuration.GameKey = ProjectSettings.Html5GameKey;
+//         Configuration.SecretKey = ProjectSettings.Html5SecretKey;
 #endif
-        }
-        UGameAnalytics::initialize(TCHAR_TO_UTF8(*gameKey), TCHAR_TO_UTF8(*secretKey));
-        bHasSessionStarted = true;
+    }
+
+    return Configuration;
+}
+
+// Applies the configuration and initializes the backend, safe to run off the game thread
+static void ApplyConfiguration(const FGAConfiguration& Configuration)
+{
+    // One crossing into the native SDK for the whole configuration
+    UGameAnalytics::configure(Configuration);
+    UGameAnalytics::initialize(TCHAR_TO_UTF8(*Configuration.GameKey), TCHAR_TO_UTF8(*Configuration.SecretKey));
+}
+
+bool FAnalyticsProviderGameAnalytics::StartSession(const TArray<FAnalyticsEventAttribute>& Attributes)
+{
+    if(!bHasSessionStarted)
+    {
+        return StartSessionWithSettings(FAnalyticsGameAnalytics::LoadProjectSettings(), Attributes);
     }
     else if(ProjectSettings.UseManualSessionHandling)
     {
+        WaitForDeferredInitialization();
         UGameAnalytics::startSession();
     }
 
     return bHasSessionStarted;
 }
 
+bool FAnalyticsProviderGameAnalytics::StartSessionWithSettings(const FAnalyticsGameAnalytics::FGameAnalyticsProjectSettings& Settings, const TArray<FAnalyticsEventAttribute>& Attributes)
+{
+    if(bHasSessionStarted)
+    {
+        return true;
+    }
+
+    SCOPE_CYCLE_COUNTER(STAT_GameAnalytics_StartSession);
+    const double StartTime = FPlatformTime::Seconds();
+
+    ProjectSettings = Settings;
+    FGAConfiguration Configuration = BuildConfiguration(Attributes);
+
+    if (ProjectSettings.UseDeferredInitialization)
+    {
+        // Events recorded until the backend is initialized stay staged
+        FGameAnalyticsEventStaging::SetHeld(true);
+        DeferredInitialization = Async(EAsyncExecution::ThreadPool, [Configuration = MoveTemp(Configuration)]()
+        {
+            const double InitializeStartTime = FPlatformTime::Seconds();
+            ApplyConfiguration(Configuration);
+            // released on the game thread, none of its events can overtake the held ones there
+            AsyncTask(ENamedThreads::GameThread, []()
+            {
+                FGameAnalyticsEventStaging::Release();
+            });
+            UE_LOG(LogGameAnalyticsAnalytics, Log, TEXT("Deferred initialization took %.2f ms"), (FPlatformTime::Seconds() - InitializeStartTime) * 1000.0);
+        });
+    }
+    else
+    {
+        ApplyConfiguration(Configuration);
+    }
+
+    bHasSessionStarted = true;
+    UE_LOG(LogGameAnalyticsAnalytics, Log, TEXT("StartSession took %.2f ms on the game thread"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    return true;
+}
+
+void FAnalyticsProviderGameAnalytics::WaitForDeferredInitialization()
+{
+    if (DeferredInitialization.IsValid())
+    {
+        DeferredInitialization.Wait();
+        // the release posted to the game thread may not have run yet, it does nothing once the hold is lifted
+        FGameAnalyticsEventStaging::Release();
+    }
+}
+
 void FAnalyticsProviderGameAnalytics::EndSession()
 {
+    WaitForDeferredInitialization();
+
     if (bHasSessionStarted)
     {
         if(ProjectSettings.UseManualSessionHandling)
@@ -446,7 +591,10 @@ void FAnalyticsProviderGameAnalytics::EndSession()
 
 void FAnalyticsProviderGameAnalytics::FlushEvents()
 {
-    UE_LOG(LogGameAnalyticsAnalytics, Warning, TEXT("FAnalyticsProviderGameAnalytics::FlushEvents ignored."));
+    WaitForDeferredInitialization();
+
+    // the native SDKs batch and send on their own, only the events staged on this side need pushing
+    UGameAnalytics::flushStagedEvents();
 }
 
 void FAnalyticsProviderGameAnalytics::SetUserID(const FString& InUserID)
@@ -481,26 +629,66 @@ bool FAnalyticsProviderGameAnalytics::SetSessionID(const FString& InSessionID)
 }
 
 void FAnalyticsProviderGameAnalytics::RecordEvent(const FString& EventName, const TArray<FAnalyticsEventAttribute>& Attributes)
+{
+    RecordEventImpl(EventName, Attributes);
+}
+
+/**
+* Routes the reserved custom1/custom2/custom3 attributes to the custom dimensions, returns false for any other attribute
+*/
+static bool SetCustomDimensionFromAttribute(const FAnalyticsEventAttribute& Attr)
+{
+    if (Attr.GetName() == TEXT("custom1"))
+    {
+        UGameAnalytics::setCustomDimension01(TCHAR_TO_UTF8(*Attr.GetValue()));
+    }
+    else if (Attr.GetName() == TEXT("custom2"))
+    {
+        UGameAnalytics::setCustomDimension02(TCHAR_TO_UTF8(*Attr.GetValue()));
+    }
+    else if (Attr.GetName() == TEXT("custom3"))
+    {
+        UGameAnalytics::setCustomDimension03(TCHAR_TO_UTF8(*Attr.GetValue()));
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+void FAnalyticsProviderGameAnalytics::RecordEventImpl(const FString& EventName, TConstArrayView<FAnalyticsEventAttribute> Attributes)
 {
     const int32 AttrCount = Attributes.Num();
-    if (AttrCount > 0)
+    if (AttrCount > 0 && ProjectSettings.RecordEventAsSingleDesignEvent && EventName.Len() > 0)
     {
-        // Send an event for each attribute
-        for (auto Attr : Attributes)
+        // Send one event carrying the attributes as custom fields
+        TSharedRef<FJsonObject> Fields = MakeShareable(new FJsonObject());
+        for (const FAnalyticsEventAttribute& Attr : Attributes)
         {
-            if (Attr.GetName() == TEXT("custom1"))
+            if (SetCustomDimensionFromAttribute(Attr))
             {
-                UGameAnalytics::setCustomDimension01(TCHAR_TO_UTF8(*Attr.GetValue()));
+                continue;
             }
-            else if (Attr.GetName() == TEXT("custom2"))
+
+            if (Attr.GetValue().IsNumeric())
             {
-                UGameAnalytics::setCustomDimension02(TCHAR_TO_UTF8(*Attr.GetValue()));
+                Fields->SetNumberField(Attr.GetName(), FCString::Atod(*Attr.GetValue()));
             }
-            else if (Attr.GetName() == TEXT("custom3"))
+            else
             {
-                UGameAnalytics::setCustomDimension03(TCHAR_TO_UTF8(*Attr.GetValue()));
+                Fields->SetStringField(Attr.GetName(), Attr.GetValue());
             }
-            else
+        }
+
+        UGameAnalytics::addDesignEvent(TCHAR_TO_UTF8(*EventName), Fields);
+    }
+    else if (AttrCount > 0)
+    {
+        // Send an event for each attribute
+        for (const FAnalyticsEventAttribute& Attr : Attributes)
+        {
+            if (!SetCustomDimensionFromAttribute(Attr))
             {
                 float AttrValue = FCString::Atof(*Attr.GetValue());
                 UGameAnalytics::addDesignEvent(TCHAR_TO_UTF8(*Attr.GetName()), AttrValue);
@@ -528,6 +716,11 @@ void FAnalyticsProviderGameAnalytics::RecordError(const FString& Error)
 }
 
 void FAnalyticsProviderGameAnalytics::RecordError(const FString& Error, const TArray<FAnalyticsEventAttribute>& Attributes)
+{
+    RecordErrorImpl(Error, Attributes);
+}
+
+void FAnalyticsProviderGameAnalytics::RecordErrorImpl(const FString& Error, TConstArrayView<FAnalyticsEventAttribute> Attributes)
 {
     static const TMap<FString, EGAErrorSeverity> k_SeverityStrings =
     {
@@ -550,7 +743,7 @@ void FAnalyticsProviderGameAnalytics::RecordError(const FString& Error, const TA
     const int32 AttrCount = Attributes.Num();
     if (AttrCount > 0)
     {
-        for (auto Attr : Attributes)
+        for (const FAnalyticsEventAttribute& Attr : Attributes)
         {
             if (Attr.GetName() == TEXT("message"))
             {
@@ -566,118 +759,54 @@ void FAnalyticsProviderGameAnalytics::RecordError(const FString& Error, const TA
 
 void FAnalyticsProviderGameAnalytics::RecordProgress(const FString& ProgressType, const FString& ProgressHierarchy)
 {
-    FString const Key = ProgressType.ToLower();
-    
-    if (!k_ProgressionStrings.Contains(Key))
-    {
-        UE_LOG(LogGameAnalyticsAnalytics, Warning, TEXT("RecordProgress: ProgressType value must be either start, complete or fail. ProgressType=%s"), *ProgressType);
-        return;
-    }
-    
-    EGAProgressionStatus ProgressionStatus = k_ProgressionStrings[Key];
-
-    UGameAnalytics::addProgressionEvent(ProgressionStatus, TCHAR_TO_UTF8(*ProgressHierarchy));
+    RecordProgressHierarchyImpl(ProgressType, MakeArrayView(&ProgressHierarchy, 1), TConstArrayView<FAnalyticsEventAttribute>());
 }
 
 void FAnalyticsProviderGameAnalytics::RecordProgress(const FString& ProgressType, const FString& ProgressHierarchy, const TArray<FAnalyticsEventAttribute>& Attributes)
 {
-    FString const Key = ProgressType.ToLower();
-    
-    if (!k_ProgressionStrings.Contains(Key))
-    {
-        UE_LOG(LogGameAnalyticsAnalytics, Warning, TEXT("RecordProgress: ProgressType value must be either start, complete or fail. ProgressType=%s"), *ProgressType);
-        return;
-    }
-    
-    EGAProgressionStatus ProgressionStatus = k_ProgressionStrings[Key];
-
-    bool useValue = false;
-
-    for (auto Attr : Attributes)
-    {
-        if (Attr.GetName() == TEXT("value"))
-        {
-            int32 value = FCString::Atoi(*Attr.GetValue());
-            useValue = true;
-
-            UGameAnalytics::addProgressionEvent(ProgressionStatus, TCHAR_TO_UTF8(*ProgressHierarchy), value);
-            break;
-        }
-    }
+    RecordProgressImpl(ProgressType, ProgressHierarchy, Attributes);
+}
 
-    if (!useValue)
-    {
-        UGameAnalytics::addProgressionEvent(ProgressionStatus, TCHAR_TO_UTF8(*ProgressHierarchy));
-    }
+void FAnalyticsProviderGameAnalytics::RecordProgressImpl(const FString& ProgressType, const FString& ProgressHierarchy, TConstArrayView<FAnalyticsEventAttribute> Attributes)
+{
+    RecordProgressHierarchyImpl(ProgressType, MakeArrayView(&ProgressHierarchy, 1), Attributes);
 }
 
 void FAnalyticsProviderGameAnalytics::RecordProgress(const FString& ProgressType, const TArray<FString>& ProgressHierarchy, const TArray<FAnalyticsEventAttribute>& Attributes)
 {
-    FString const Key = ProgressType.ToLower();
-    
-    if (!k_ProgressionStrings.Contains(Key))
+    RecordProgressHierarchyImpl(ProgressType, ProgressHierarchy, Attributes);
+}
+
+void FAnalyticsProviderGameAnalytics::RecordProgressHierarchyImpl(const FString& ProgressType, TConstArrayView<FString> ProgressHierarchy, TConstArrayView<FAnalyticsEventAttribute> Attributes)
+{
+    EGAProgressionStatus ProgressionStatus;
+    if (!FindProgressionStatus(ProgressType, ProgressionStatus))
     {
-        UE_LOG(LogGameAnalyticsAnalytics, Warning, TEXT("RecordProgress: ProgressType value must be either start, complete or fail. ProgressType=%s"), *ProgressType);
         return;
     }
-    
-    EGAProgressionStatus ProgressionStatus = k_ProgressionStrings[Key];
 
-    const int32 ProgressHierarchyCount = ProgressHierarchy.Num();
-    if(ProgressHierarchyCount > 0)
+    if (ProgressHierarchy.Num() == 0)
     {
-        bool useValue = false;
+        UE_LOG(LogGameAnalyticsAnalytics, Warning, TEXT("FAnalyticsProviderGameAnalytics::RecordProgress wrong usage, for correct usage see: https://docs.gameanalytics.com/integrations/sdk/unreal/event-tracking"));
+        return;
+    }
 
-        for (auto Attr : Attributes)
-        {
-            UE_LOG(LogGameAnalyticsAnalytics, Warning, TEXT("RecordProgress: Attributes. AttrName=%s"), *Attr.GetName());
-            if (Attr.GetName() == TEXT("value"))
-            {
-                int32 value = FCString::Atoi(*Attr.GetValue());
-                useValue = true;
+    // parts past the third are ignored
+    const FGAProgressionPathCache::FPathRef Path = ProgressionPaths.Get(ProgressHierarchy);
+    FGAEventDescriptor Descriptor(EGAEventKind::Progression, false, Path->Get(0), Path->Get(1), Path->Get(2));
+    Descriptor.SetType((uint8)ProgressionStatus);
 
-                if (ProgressHierarchyCount > 2)
-                {
-                    UGameAnalytics::addProgressionEvent(ProgressionStatus, TCHAR_TO_UTF8(*ProgressHierarchy[0]), TCHAR_TO_UTF8(*ProgressHierarchy[1]), TCHAR_TO_UTF8(*ProgressHierarchy[2]), value);
-                }
-                else if (ProgressHierarchyCount > 1)
-                {
-                    UGameAnalytics::addProgressionEvent(ProgressionStatus, TCHAR_TO_UTF8(*ProgressHierarchy[0]), TCHAR_TO_UTF8(*ProgressHierarchy[1]), value);
-                }
-                else
-                {
-                    UGameAnalytics::addProgressionEvent(ProgressionStatus, TCHAR_TO_UTF8(*ProgressHierarchy[0]), value);
-                }
-                break;
-            }
-        }
-
-        if (ProgressHierarchyCount > 2)
-        {
-            if(!useValue)
-            {
-                UGameAnalytics::addProgressionEvent(ProgressionStatus, TCHAR_TO_UTF8(*ProgressHierarchy[0]), TCHAR_TO_UTF8(*ProgressHierarchy[1]), TCHAR_TO_UTF8(*ProgressHierarchy[2]));
-            }
-        }
-        else if (ProgressHierarchyCount > 1)
-        {
-            if(!useValue)
-            {
-                UGameAnalytics::addProgressionEvent(ProgressionStatus, TCHAR_TO_UTF8(*ProgressHierarchy[0]), TCHAR_TO_UTF8(*ProgressHierarchy[1]));
-            }
-        }
-        else
+    for (const FAnalyticsEventAttribute& Attr : Attributes)
+    {
+        if (Attr.GetName() == TEXT("value"))
         {
-            if(!useValue)
-            {
-                UGameAnalytics::addProgressionEvent(ProgressionStatus, TCHAR_TO_UTF8(*ProgressHierarchy[0]));
-            }
+            Descriptor.Kind = EGAEventKind::ProgressionWithScore;
+            Descriptor.SetInt(FCString::Atoi(*Attr.GetValue()));
+            break;
         }
     }
-    else
-    {
-        UE_LOG(LogGameAnalyticsAnalytics, Warning, TEXT("FAnalyticsProviderGameAnalytics::RecordProgress wrong usage, for correct usage see: https://docs.gameanalytics.com/integrations/sdk/unreal/event-tracking"));
-    }
+
+    UGameAnalytics::submitEvent(Descriptor, nullptr);
 }
 
 void FAnalyticsProviderGameAnalytics::RecordItemPurchase(const FString& ItemId, const FString& Currency, int PerItemCost, int ItemQuantity)
@@ -686,6 +815,11 @@ void FAnalyticsProviderGameAnalytics::RecordItemPurchase(const FString& ItemId,
 }
 
 void FAnalyticsProviderGameAnalytics::RecordItemPurchase(const FString& ItemId, int ItemQuantity, const TArray<FAnalyticsEventAttribute>& Attributes)
+{
+    RecordItemPurchaseImpl(ItemId, ItemQuantity, Attributes);
+}
+
+void FAnalyticsProviderGameAnalytics::RecordItemPurchaseImpl(const FString& ItemId, int ItemQuantity, TConstArrayView<FAnalyticsEventAttribute> Attributes)
 {
     static const TMap<FString, EGAResourceFlowType> k_FlowTypes = {
         {TEXT("sink"), EGAResourceFlowType::sink},
@@ -699,7 +833,7 @@ void FAnalyticsProviderGameAnalytics::RecordItemPurchase(const FString& ItemId,
     const int32 AttrCount = Attributes.Num();
     if (AttrCount > 0)
     {
-        for (auto Attr : Attributes)
+        for (const FAnalyticsEventAttribute& Attr : Attributes)
         {
             if (Attr.GetName() == TEXT("flowType"))
             {
@@ -748,6 +882,11 @@ void FAnalyticsProviderGameAnalytics::RecordCurrencyPurchase(const FString& Game
 }
 
 void FAnalyticsProviderGameAnalytics::RecordCurrencyPurchase(const FString& GameCurrencyType, int GameCurrencyAmount, const TArray<FAnalyticsEventAttribute>& Attributes)
+{
+    RecordCurrencyPurchaseImpl(GameCurrencyType, GameCurrencyAmount, Attributes);
+}
+
+void FAnalyticsProviderGameAnalytics::RecordCurrencyPurchaseImpl(const FString& GameCurrencyType, int GameCurrencyAmount, TConstArrayView<FAnalyticsEventAttribute> Attributes)
 {
     FString ItemType;
     FString ItemId;
@@ -759,10 +898,8 @@ void FAnalyticsProviderGameAnalytics::RecordCurrencyPurchase(const FString& Game
     const int32 AttrCount = Attributes.Num();
     if (AttrCount > 0)
     {
-        for (auto Attr : Attributes)
+        for (const FAnalyticsEventAttribute& Attr : Attributes)
         {
-            FString AttrString = Attr.GetName();
-
             if (Attr.GetName() == TEXT("itemType"))
             {
                 ItemType = Attr.GetValue();
@@ -15,6 +15,7 @@
 
 #include "UObject/Object.h"
 #include "Dom/JsonObject.h"
+#include "Containers/ArrayView.h"
 #include "GameAnalytics.generated.h"
 
 #if PLATFORM_MAC || PLATFORM_WINDOWS || PLATFORM_LINUX
@@ -89,6 +90,18 @@ enum class EGAAdError : uint8
     unabletoprecache = 6
 };
 
+UENUM(BlueprintType)
+enum class EGACustomFieldType : uint8
+{
+    // Value is sent as a number when it parses as one, otherwise as a string
+    autodetect = 0,
+    integer = 1,
+    number = 2,
+    boolean = 3,
+    string = 4,
+    name = 5
+};
+
 USTRUCT(BlueprintType)
 struct FGameAnalyticsCustomEventField
 {
@@ -99,6 +112,171 @@ struct FGameAnalyticsCustomEventField
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GameAnalytics")
     FString Value;
+
+    // Set by the Make*Field functions only, the typed values it selects are not editable, fields left on autodetect keep the old behaviour
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GameAnalytics")
+    EGACustomFieldType Type = EGACustomFieldType::autodetect;
+
+    UPROPERTY()
+    int64 IntegerValue = 0;
+
+    UPROPERTY()
+    double NumberValue = 0.0;
+
+    UPROPERTY()
+    bool BoolValue = false;
+
+    UPROPERTY()
+    FName NameValue;
+};
+
+/** Key, old value and new value of a remote config that changed, empty values stand for added or removed keys */
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FGAOnRemoteConfigKeyChanged, const FString&, const FString&, const FString&);
+
+/** A/B testing id and variant id of an assignment that differs from the cached one */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FGAOnABTestingAssignmentChanged, const FString&, const FString&);
+
+/**
+ * Limits applied while custom fields are serialized, so oversized payloads are cut down before they are marshalled.
+ * Fields over the count, key length or payload limits are dropped, long string values are truncated. Zero disables a limit.
+ */
+struct FGACustomFieldsLimits
+{
+    int32 MaxFields = 50;
+    int32 MaxKeyLength = 64;
+    int32 MaxValueLength = 256;
+    /** Size of the whole UTF-8 serialized custom fields object */
+    int32 MaxPayloadBytes = 4096;
+};
+
+/**
+ * Budget of one distinct error, errors with the same severity and message apart from numbers share it.
+ * Burst errors go through at once, after that PerMinute. A Burst of zero disables the limit for the severity.
+ */
+struct FGAErrorRateLimit
+{
+    int32 Burst = 10;
+    float PerMinute = 6.0f;
+};
+
+/**
+ * Complete configuration applied to the backend before it is initialized.
+ * Collected up front so the whole startup sequence can be applied in one go, on any thread.
+ */
+struct FGAConfiguration
+{
+    /** Where the C++ SDK keeps its database, ignored by the mobile SDKs */
+    FString WritablePath;
+    /** Build version, ignored when AutoDetectAppVersion is set on mobile */
+    FString Build;
+    bool bAutoDetectAppVersion = false;
+    bool bDisableDeviceInfo = false;
+    bool bUseManualSessionHandling = false;
+    bool bUseErrorReporting = true;
+    bool bInfoLog = true;
+    bool bVerboseLog = false;
+    TArray<FString> ResourceCurrencies;
+    TArray<FString> ResourceItemTypes;
+    TArray<FString> CustomDimensions01;
+    TArray<FString> CustomDimensions02;
+    TArray<FString> CustomDimensions03;
+    /** Replaces the limits set through configureCustomFieldsLimits, left alone when unset */
+    TOptional<FGACustomFieldsLimits> CustomFieldsLimits;
+    FString GameKey;
+    FString SecretKey;
+};
+
+/** Event types understood by UGameAnalytics::submitEvent */
+enum class EGAEventKind : uint8
+{
+    Business,
+    // iOS only
+    BusinessWithReceipt,
+    // iOS only
+    BusinessAutoFetchReceipt,
+    // Android only, Google Play receipt and signature
+    BusinessWithSignature,
+    Resource,
+    Progression,
+    ProgressionWithScore,
+    Design,
+    DesignWithValue,
+    Error,
+    // iOS and Android only
+    Ad,
+    AdWithDuration,
+    AdWithNoAdReason
+};
+
+/**
+ * Plain description of one event, the single input of the event pipeline behind all add*Event overloads.
+ * Strings are borrowed from the caller and only copied when the event has to be staged.
+ */
+struct FGAEventDescriptor
+{
+    static constexpr int32 MaxStrings = 6;
+
+    FGAEventDescriptor(EGAEventKind InKind, bool bInMergeFields, const char* String0 = nullptr, const char* String1 = nullptr, const char* String2 = nullptr, const char* String3 = nullptr, const char* String4 = nullptr, const char* String5 = nullptr)
+        : Kind(InKind)
+        , bMergeFields(bInMergeFields)
+        , Strings{ String0, String1, String2, String3, String4, String5 }
+    {
+    }
+
+    FGAEventDescriptor& SetType(uint8 InType) { Type = InType; return *this; }
+    FGAEventDescriptor& SetSubType(uint8 InSubType) { SubType = InSubType; return *this; }
+    FGAEventDescriptor& SetReason(uint8 InReason) { Reason = InReason; return *this; }
+    FGAEventDescriptor& SetInt(int64 InValue) { IntValue = InValue; return *this; }
+    FGAEventDescriptor& SetFloat(float InValue) { FloatValue = InValue; return *this; }
+
+    EGAEventKind Kind;
+    bool bMergeFields;
+    /** Resource flow type, progression status, error severity or ad action */
+    uint8 Type = 0;
+    /** Ad type */
+    uint8 SubType = 0;
+    /** No ad reason */
+    uint8 Reason = 0;
+    /** Business amount, progression score or ad duration */
+    int64 IntValue = 0;
+    /** Resource amount or design value */
+    float FloatValue = 0.0f;
+    /**
+     * The string parameters in the order of the add*Event signature:
+     * currency, item type, item id, cart type, receipt and signature for business events,
+     * currency, item type and item id for resource events, the progression parts, the design event id,
+     * the error message and the ad sdk name and placement.
+     */
+    const char* Strings[MaxStrings];
+};
+
+/**
+ * Shared context fields attached to every event raised on the calling thread while the scope is alive.
+ * The fields are serialized once, events only splice the prebuilt fragment into their own fields.
+ * Keys set on the event win over context keys and inner scopes win over outer ones.
+ */
+class GAMEANALYTICS_API FGAScopedContext
+{
+public:
+    /** Serialized context fields, immutable so one fragment can back any number of scopes on any thread */
+    struct FFragment
+    {
+        TArray<FString> Keys;
+        /** UTF-8 serialized "key":value members, same order as Keys */
+        TArray<TArray<ANSICHAR> > Members;
+    };
+
+    static TSharedRef<const FFragment> MakeFragment(const TSharedRef<FJsonObject>& fields);
+
+    explicit FGAScopedContext(const TSharedRef<FJsonObject>& fields);
+    explicit FGAScopedContext(const TSharedRef<const FFragment>& fragment);
+    ~FGAScopedContext();
+
+    FGAScopedContext(const FGAScopedContext&) = delete;
+    FGAScopedContext& operator=(const FGAScopedContext&) = delete;
+
+private:
+    TSharedRef<const FFragment> Fragment;
 };
 
 UCLASS()
@@ -114,6 +292,9 @@ public:
 
     static void configureAvailableResourceCurrencies(const TArray<FString>& list);
     static void configureAvailableResourceItemTypes(const TArray<FString>& list);
+    static void configureCustomFieldsLimits(const FGACustomFieldsLimits& limits);
+    // Errors over the budget of their severity are dropped and reported once a minute in a single summary error event
+    static void configureErrorRateLimit(EGAErrorSeverity severity, const FGAErrorRateLimit& limit);
 
     static void configureBuild(const char *build);
     static void configureAutoDetectAppVersion(bool flag);
@@ -121,65 +302,70 @@ public:
     static void configureUserId(const char *userId);
     static void configureSdkGameEngineVersion(const char *gameEngineSdkVersion);
     static void configureGameEngineVersion(const char *gameEngineVersion);
+    // Applies a complete configuration with a single call into the native SDK, use instead of the individual configure calls
+    static void configure(const FGAConfiguration& configuration);
     static void initialize(const char *gameKey, const char *gameSecret);
 
+    // Single entry point of every add*Event overload, fields may be null
+    static void submitEvent(const FGAEventDescriptor& descriptor, const TSharedPtr<FJsonObject>& customFields);
+
 #if PLATFORM_IOS
-    static void addBusinessEvent(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType, const char *receipt);
-    static void addBusinessEvent(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType, const char *receipt, const TSharedRef<FJsonObject> &customFields);
-    static void addBusinessEvent(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType, const char *receipt, const TSharedRef<FJsonObject> &customFields, bool mergeFields);
-    static void addBusinessEventAndAutoFetchReceipt(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType);
-    static void addBusinessEventAndAutoFetchReceipt(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType, const TSharedRef<FJsonObject> &customFields);
-    static void addBusinessEventAndAutoFetchReceipt(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType, const TSharedRef<FJsonObject> &customFields, bool mergeFields);
+    static void addBusinessEvent(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType, const char *receipt) { submitEvent(FGAEventDescriptor(EGAEventKind::BusinessWithReceipt, false, currency, itemType, itemId, cartType, receipt).SetInt(amount), nullptr); }
+    static void addBusinessEvent(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType, const char *receipt, const TSharedRef<FJsonObject> &customFields) { submitEvent(FGAEventDescriptor(EGAEventKind::BusinessWithReceipt, false, currency, itemType, itemId, cartType, receipt).SetInt(amount), customFields); }
+    static void addBusinessEvent(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType, const char *receipt, const TSharedRef<FJsonObject> &customFields, bool mergeFields) { submitEvent(FGAEventDescriptor(EGAEventKind::BusinessWithReceipt, mergeFields, currency, itemType, itemId, cartType, receipt).SetInt(amount), customFields); }
+    static void addBusinessEventAndAutoFetchReceipt(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType) { submitEvent(FGAEventDescriptor(EGAEventKind::BusinessAutoFetchReceipt, false, currency, itemType, itemId, cartType).SetInt(amount), nullptr); }
+    static void addBusinessEventAndAutoFetchReceipt(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType, const TSharedRef<FJsonObject> &customFields) { submitEvent(FGAEventDescriptor(EGAEventKind::BusinessAutoFetchReceipt, false, currency, itemType, itemId, cartType).SetInt(amount), customFields); }
+    static void addBusinessEventAndAutoFetchReceipt(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType, const TSharedRef<FJsonObject> &customFields, bool mergeFields) { submitEvent(FGAEventDescriptor(EGAEventKind::BusinessAutoFetchReceipt, mergeFields, currency, itemType, itemId, cartType).SetInt(amount), customFields); }
 #elif PLATFORM_ANDROID
-    static void addBusinessEvent(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType, const char *receipt, const char *signature);
-    static void addBusinessEvent(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType, const char *receipt, const char *signature, const TSharedRef<FJsonObject> &customFields);
-    static void addBusinessEvent(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType, const char *receipt, const char *signature, const TSharedRef<FJsonObject> &customFields, bool mergeFields);
+    static void addBusinessEvent(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType, const char *receipt, const char *signature) { submitEvent(FGAEventDescriptor(EGAEventKind::BusinessWithSignature, false, currency, itemType, itemId, cartType, receipt, signature).SetInt(amount), nullptr); }
+    static void addBusinessEvent(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType, const char *receipt, const char *signature, const TSharedRef<FJsonObject> &customFields) { submitEvent(FGAEventDescriptor(EGAEventKind::BusinessWithSignature, false, currency, itemType, itemId, cartType, receipt, signature).SetInt(amount), customFields); }
+    static void addBusinessEvent(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType, const char *receipt, const char *signature, const TSharedRef<FJsonObject> &customFields, bool mergeFields) { submitEvent(FGAEventDescriptor(EGAEventKind::BusinessWithSignature, mergeFields, currency, itemType, itemId, cartType, receipt, signature).SetInt(amount), customFields); }
 #endif
 
-    static void addBusinessEvent(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType);
-    static void addBusinessEvent(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType, const TSharedRef<FJsonObject> &customFields);
-    static void addBusinessEvent(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType, const TSharedRef<FJsonObject> &customFields, bool mergeFields);
-    static void addResourceEvent(EGAResourceFlowType flowType, const char *currency, float amount, const char *itemType, const char *itemId);
-    static void addResourceEvent(EGAResourceFlowType flowType, const char *currency, float amount, const char *itemType, const char *itemId, const TSharedRef<FJsonObject> &customFields);
-    static void addResourceEvent(EGAResourceFlowType flowType, const char *currency, float amount, const char *itemType, const char *itemId, const TSharedRef<FJsonObject> &customFields, bool mergeFields);
-    static void addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01);
-    static void addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const TSharedRef<FJsonObject> &customFields);
-    static void addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const TSharedRef<FJsonObject> &customFields, bool mergeFields);
-    static void addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, int score);
-    static void addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, int score, const TSharedRef<FJsonObject> &customFields);
-    static void addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, int score, const TSharedRef<FJsonObject> &customFields, bool mergeFields);
-    static void addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const char *progression02);
-    static void addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const char *progression02, const TSharedRef<FJsonObject> &customFields);
-    static void addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const char *progression02, const TSharedRef<FJsonObject> &customFields, bool mergeFields);
-    static void addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const char *progression02, int score);
-    static void addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const char *progression02, int score, const TSharedRef<FJsonObject> &customFields);
-    static void addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const char *progression02, int score, const TSharedRef<FJsonObject> &customFields, bool mergeFields);
-    static void addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const char *progression02, const char *progression03);
-    static void addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const char *progression02, const char *progression03, const TSharedRef<FJsonObject> &customFields);
-    static void addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const char *progression02, const char *progression03, const TSharedRef<FJsonObject> &customFields, bool mergeFields);
-    static void addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const char *progression02, const char *progression03, int score);
-    static void addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const char *progression02, const char *progression03, int score, const TSharedRef<FJsonObject> &customFields);
-    static void addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const char *progression02, const char *progression03, int score, const TSharedRef<FJsonObject> &customFields, bool mergeFields);
-    static void addDesignEvent(const char *eventId);
-    static void addDesignEvent(const char *eventId, const TSharedRef<FJsonObject> &customFields);
-    static void addDesignEvent(const char *eventId, const TSharedRef<FJsonObject> &customFields, bool mergeFields);
-    static void addDesignEvent(const char *eventId, float value);
-    static void addDesignEvent(const char *eventId, float value, const TSharedRef<FJsonObject> &customFields);
-    static void addDesignEvent(const char *eventId, float value, const TSharedRef<FJsonObject> &customFields, bool mergeFields);
-    static void addErrorEvent(EGAErrorSeverity severity, const char *message);
-    static void addErrorEvent(EGAErrorSeverity severity, const char *message, const TSharedRef<FJsonObject> &customFields);
-    static void addErrorEvent(EGAErrorSeverity severity, const char *message, const TSharedRef<FJsonObject> &customFields, bool mergeFields);
+    static void addBusinessEvent(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType) { submitEvent(FGAEventDescriptor(EGAEventKind::Business, false, currency, itemType, itemId, cartType).SetInt(amount), nullptr); }
+    static void addBusinessEvent(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType, const TSharedRef<FJsonObject> &customFields) { submitEvent(FGAEventDescriptor(EGAEventKind::Business, false, currency, itemType, itemId, cartType).SetInt(amount), customFields); }
+    static void addBusinessEvent(const char *currency, int amount, const char *itemType, const char *itemId, const char *cartType, const TSharedRef<FJsonObject> &customFields, bool mergeFields) { submitEvent(FGAEventDescriptor(EGAEventKind::Business, mergeFields, currency, itemType, itemId, cartType).SetInt(amount), customFields); }
+    static void addResourceEvent(EGAResourceFlowType flowType, const char *currency, float amount, const char *itemType, const char *itemId) { submitEvent(FGAEventDescriptor(EGAEventKind::Resource, false, currency, itemType, itemId).SetType((uint8)flowType).SetFloat(amount), nullptr); }
+    static void addResourceEvent(EGAResourceFlowType flowType, const char *currency, float amount, const char *itemType, const char *itemId, const TSharedRef<FJsonObject> &customFields) { submitEvent(FGAEventDescriptor(EGAEventKind::Resource, false, currency, itemType, itemId).SetType((uint8)flowType).SetFloat(amount), customFields); }
+    static void addResourceEvent(EGAResourceFlowType flowType, const char *currency, float amount, const char *itemType, const char *itemId, const TSharedRef<FJsonObject> &customFields, bool mergeFields) { submitEvent(FGAEventDescriptor(EGAEventKind::Resource, mergeFields, currency, itemType, itemId).SetType((uint8)flowType).SetFloat(amount), customFields); }
+    static void addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01) { submitEvent(FGAEventDescriptor(EGAEventKind::Progression, false, progression01).SetType((uint8)progressionStatus), nullptr); }
+    static void addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const TSharedRef<FJsonObject> &customFields) { submitEvent(FGAEventDescriptor(EGAEventKind::Progression, false, progression01).SetType((uint8)progressionStatus), customFields); }
+    static void addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const TSharedRef<FJsonObject> &customFields, bool mergeFields) { submitEvent(FGAEventDescriptor(EGAEventKind::Progression, mergeFields, progression01).SetType((uint8)progressionStatus), customFields); }
+    static void addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, int score) { submitEvent(FGAEventDescriptor(EGAEventKind::ProgressionWithScore, false, progression01).SetType((uint8)progressionStatus).SetInt(score), nullptr); }
+    static void addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, int score, const TSharedRef<FJsonObject> &customFields) { submitEvent(FGAEventDescriptor(EGAEventKind::ProgressionWithScore, false, progression01).SetType((uint8)progressionStatus).SetInt(score), customFields); }
+    static void addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, int score, const TSharedRef<FJsonObject> &customFields, bool mergeFields) { submitEvent(FGAEventDescriptor(EGAEventKind::ProgressionWithScore, mergeFields, progression01).SetType((uint8)progressionStatus).SetInt(score), customFields); }
+    static void addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const char *progression02) { submitEvent(FGAEventDescriptor(EGAEventKind::Progression, false, progression01, progression02).SetType((uint8)progressionStatus), nullptr); }
+    static void addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const char *progression02, const TSharedRef<FJsonObject> &customFields) { submitEvent(FGAEventDescriptor(EGAEventKind::Progression, false, progression01, progression02).SetType((uint8)progressionStatus), customFields); }
+    static void addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const char *progression02, const TSharedRef<FJsonObject> &customFields, bool mergeFields) { submitEvent(FGAEventDescriptor(EGAEventKind::Progression, mergeFields, progression01, progression02).SetType((uint8)progressionStatus), customFields); }
+    static void addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const char *progression02, int score) { submitEvent(FGAEventDescriptor(EGAEventKind::ProgressionWithScore, false, progression01, progression02).SetType((uint8)progressionStatus).SetInt(score), nullptr); }
+    static void addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const char *progression02, int score, const TSharedRef<FJsonObject> &customFields) { submitEvent(FGAEventDescriptor(EGAEventKind::ProgressionWithScore, false, progression01, progression02).SetType((uint8)progressionStatus).SetInt(score), customFields); }
+    static void addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const char *progression02, int score, const TSharedRef<FJsonObject> &customFields, bool mergeFields) { submitEvent(FGAEventDescriptor(EGAEventKind::ProgressionWithScore, mergeFields, progression01, progression02).SetType((uint8)progressionStatus).SetInt(score), customFields); }
+    static void addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const char *progression02, const char *progression03) { submitEvent(FGAEventDescriptor(EGAEventKind::Progression, false, progression01, progression02, progression03).SetType((uint8)progressionStatus), nullptr); }
+    static void addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const char *progression02, const char *progression03, const TSharedRef<FJsonObject> &customFields) { submitEvent(FGAEventDescriptor(EGAEventKind::Progression, false, progression01, progression02, progression03).SetType((uint8)progressionStatus), customFields); }
+    static void addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const char *progression02, const char *progression03, const TSharedRef<FJsonObject> &customFields, bool mergeFields) { submitEvent(FGAEventDescriptor(EGAEventKind::Progression, mergeFields, progression01, progression02, progression03).SetType((uint8)progressionStatus), customFields); }
+    static void addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const char *progression02, const char *progression03, int score) { submitEvent(FGAEventDescriptor(EGAEventKind::ProgressionWithScore, false, progression01, progression02, progression03).SetType((uint8)progressionStatus).SetInt(score), nullptr); }
+    static void addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const char *progression02, const char *progression03, int score, const TSharedRef<FJsonObject> &customFields) { submitEvent(FGAEventDescriptor(EGAEventKind::ProgressionWithScore, false, progression01, progression02, progression03).SetType((uint8)progressionStatus).SetInt(score), customFields); }
+    static void addProgressionEvent(EGAProgressionStatus progressionStatus, const char *progression01, const char *progression02, const char *progression03, int score, const TSharedRef<FJsonObject> &customFields, bool mergeFields) { submitEvent(FGAEventDescriptor(EGAEventKind::ProgressionWithScore, mergeFields, progression01, progression02, progression03).SetType((uint8)progressionStatus).SetInt(score), customFields); }
+    static void addDesignEvent(const char *eventId) { submitEvent(FGAEventDescriptor(EGAEventKind::Design, false, eventId), nullptr); }
+    static void addDesignEvent(const char *eventId, const TSharedRef<FJsonObject> &customFields) { submitEvent(FGAEventDescriptor(EGAEventKind::Design, false, eventId), customFields); }
+    static void addDesignEvent(const char *eventId, const TSharedRef<FJsonObject> &customFields, bool mergeFields) { submitEvent(FGAEventDescriptor(EGAEventKind::Design, mergeFields, eventId), customFields); }
+    static void addDesignEvent(const char *eventId, float value) { submitEvent(FGAEventDescriptor(EGAEventKind::DesignWithValue, false, eventId).SetFloat(value), nullptr); }
+    static void addDesignEvent(const char *eventId, float value, const TSharedRef<FJsonObject> &customFields) { submitEvent(FGAEventDescriptor(EGAEventKind::DesignWithValue, false, eventId).SetFloat(value), customFields); }
+    static void addDesignEvent(const char *eventId, float value, const TSharedRef<FJsonObject> &customFields, bool mergeFields) { submitEvent(FGAEventDescriptor(EGAEventKind::DesignWithValue, mergeFields, eventId).SetFloat(value), customFields); }
+    static void addErrorEvent(EGAErrorSeverity severity, const char *message) { submitEvent(FGAEventDescriptor(EGAEventKind::Error, false, message).SetType((uint8)severity), nullptr); }
+    static void addErrorEvent(EGAErrorSeverity severity, const char *message, const TSharedRef<FJsonObject> &customFields) { submitEvent(FGAEventDescriptor(EGAEventKind::Error, false, message).SetType((uint8)severity), customFields); }
+    static void addErrorEvent(EGAErrorSeverity severity, const char *message, const TSharedRef<FJsonObject> &customFields, bool mergeFields) { submitEvent(FGAEventDescriptor(EGAEventKind::Error, mergeFields, message).SetType((uint8)severity), customFields); }
 
 #if PLATFORM_IOS || PLATFORM_ANDROID
-    static void addAdEvent(EGAAdAction action, EGAAdType adType, const char *adSdkName, const char *adPlacement);
-    static void addAdEvent(EGAAdAction action, EGAAdType adType, const char *adSdkName, const char *adPlacement, const TSharedRef<FJsonObject> &customFields);
-    static void addAdEvent(EGAAdAction action, EGAAdType adType, const char *adSdkName, const char *adPlacement, const TSharedRef<FJsonObject> &customFields, bool mergeFields);
-    static void addAdEventWithDuration(EGAAdAction action, EGAAdType adType, const char *adSdkName, const char *adPlacement, int64_t duration);
-    static void addAdEventWithDuration(EGAAdAction action, EGAAdType adType, const char *adSdkName, const char *adPlacement, int64_t duration, const TSharedRef<FJsonObject> &customFields);
-    static void addAdEventWithDuration(EGAAdAction action, EGAAdType adType, const char *adSdkName, const char *adPlacement, int64_t duration, const TSharedRef<FJsonObject> &customFields, bool mergeFields);
-    static void addAdEventWithNoAdReason(EGAAdAction action, EGAAdType adType, const char *adSdkName, const char *adPlacement, EGAAdError noAdReason);
-    static void addAdEventWithNoAdReason(EGAAdAction action, EGAAdType adType, const char *adSdkName, const char *adPlacement, EGAAdError noAdReason, const TSharedRef<FJsonObject> &customFields);
-    static void addAdEventWithNoAdReason(EGAAdAction action, EGAAdType adType, const char *adSdkName, const char *adPlacement, EGAAdError noAdReason, const TSharedRef<FJsonObject> &customFields, bool mergeFields);
+    static void addAdEvent(EGAAdAction action, EGAAdType adType, const char *adSdkName, const char *adPlacement) { submitEvent(FGAEventDescriptor(EGAEventKind::Ad, false, adSdkName, adPlacement).SetType((uint8)action).SetSubType((uint8)adType), nullptr); }
+    static void addAdEvent(EGAAdAction action, EGAAdType adType, const char *adSdkName, const char *adPlacement, const TSharedRef<FJsonObject> &customFields) { submitEvent(FGAEventDescriptor(EGAEventKind::Ad, false, adSdkName, adPlacement).SetType((uint8)action).SetSubType((uint8)adType), customFields); }
+    static void addAdEvent(EGAAdAction action, EGAAdType adType, const char *adSdkName, const char *adPlacement, const TSharedRef<FJsonObject> &customFields, bool mergeFields) { submitEvent(FGAEventDescriptor(EGAEventKind::Ad, mergeFields, adSdkName, adPlacement).SetType((uint8)action).SetSubType((uint8)adType), customFields); }
+    static void addAdEventWithDuration(EGAAdAction action, EGAAdType adType, const char *adSdkName, const char *adPlacement, int64_t duration) { submitEvent(FGAEventDescriptor(EGAEventKind::AdWithDuration, false, adSdkName, adPlacement).SetType((uint8)action).SetSubType((uint8)adType).SetInt(duration), nullptr); }
+    static void addAdEventWithDuration(EGAAdAction action, EGAAdType adType, const char *adSdkName, const char *adPlacement, int64_t duration, const TSharedRef<FJsonObject> &customFields) { submitEvent(FGAEventDescriptor(EGAEventKind::AdWithDuration, false, adSdkName, adPlacement).SetType((uint8)action).SetSubType((uint8)adType).SetInt(duration), customFields); }
+    static void addAdEventWithDuration(EGAAdAction action, EGAAdType adType, const char *adSdkName, const char *adPlacement, int64_t duration, const TSharedRef<FJsonObject> &customFields, bool mergeFields) { submitEvent(FGAEventDescriptor(EGAEventKind::AdWithDuration, mergeFields, adSdkName, adPlacement).SetType((uint8)action).SetSubType((uint8)adType).SetInt(duration), customFields); }
+    static void addAdEventWithNoAdReason(EGAAdAction action, EGAAdType adType, const char *adSdkName, const char *adPlacement, EGAAdError noAdReason) { submitEvent(FGAEventDescriptor(EGAEventKind::AdWithNoAdReason, false, adSdkName, adPlacement).SetType((uint8)action).SetSubType((uint8)adType).SetReason((uint8)noAdReason), nullptr); }
+    static void addAdEventWithNoAdReason(EGAAdAction action, EGAAdType adType, const char *adSdkName, const char *adPlacement, EGAAdError noAdReason, const TSharedRef<FJsonObject> &customFields) { submitEvent(FGAEventDescriptor(EGAEventKind::AdWithNoAdReason, false, adSdkName, adPlacement).SetType((uint8)action).SetSubType((uint8)adType).SetReason((uint8)noAdReason), customFields); }
+    static void addAdEventWithNoAdReason(EGAAdAction action, EGAAdType adType, const char *adSdkName, const char *adPlacement, EGAAdError noAdReason, const TSharedRef<FJsonObject> &customFields, bool mergeFields) { submitEvent(FGAEventDescriptor(EGAEventKind::AdWithNoAdReason, mergeFields, adSdkName, adPlacement).SetType((uint8)action).SetSubType((uint8)adType).SetReason((uint8)noAdReason), customFields); }
 #endif
 
     static void setEnabledInfoLog(bool flag);
@@ -187,6 +373,16 @@ public:
     static void setEnabledManualSessionHandling(bool flag);
     static void setEnabledErrorReporting(bool flag);
     static void setEnabledEventSubmission(bool flag);
+    // Stage events in per-thread buffers and submit them from the game thread tick instead of calling the backend directly
+    static void setEnabledEventStaging(bool flag);
+    // Pair progression start events with their complete and fail events and add progression_elapsed_seconds and progression_attempt fields to the latter
+    static void setEnabledProgressionTracking(bool flag);
+    // Hold ad events for the window and coalesce identical ones (action, ad type, SDK name, placement) raised meanwhile into one event with an ad_event_count field, 0 disables
+    static void setAdEventDeduplicationWindow(float seconds);
+    // Categories whose UE_LOG errors, and warnings when includeWarnings is set, the log bridge turns into error events, all categories when empty
+    static void configureLogBridge(const TArray<FName>& categories, bool includeWarnings);
+    // Capture log lines on any thread and raise the error events from a background thread, respects setEnabledErrorReporting
+    static void setEnabledLogBridge(bool flag);
     static void setCustomDimension01(const char *customDimension);
     static void setCustomDimension02(const char *customDimension);
     static void setCustomDimension03(const char *customDimension);
@@ -195,14 +391,33 @@ public:
     static void endSession();
 
     static void onQuit();
+    // Submits all events currently held in the per-thread staging buffers, every held ad event and the suppressed errors summary when it is due
+    // Waits for receipt business events still being prepared on the pool, so none of them is left behind
+    static void flushStagedEvents();
+    // Per frame variant of flushStagedEvents, only submits the ad events whose deduplication window has passed, never waits and keeps the staged events back while a receipt business event is being prepared
+    // Receipt business events keep their place among the other events only while staging is enabled, without staging later events may overtake them
+    static void tickStagedEvents();
 
     static FString getRemoteConfigsValueAsString(const char *key);
     static FString getRemoteConfigsValueAsString(const char *key, const char *defaultValue);
     static bool isRemoteConfigsReady();
     static FString getRemoteConfigsContentAsString();
-
+    // Reads every remote config with a single call into the native SDK
+    static bool getRemoteConfigsContent(TMap<FString, FString>& out);
+    // Looks up all keys from one fetch of the remote configs, missing keys give an empty string
+    static void getRemoteConfigsValues(TArrayView<const FString> keys, TArray<FString>& out);
+    // Diffs the current remote configs against the previous snapshot and fires OnRemoteConfigKeyChanged for every changed key, game thread only
+    static void checkRemoteConfigsForChanges();
+    // Fired on the game thread for every remote config key that changed when the remote configs refresh
+    static FGAOnRemoteConfigKeyChanged OnRemoteConfigKeyChanged;
+
+    // Last known assignment, served from the on-disk cache until the native SDK reports one for this session
     static FString getABTestingId();
     static FString getABTestingVariantId();
+    // Reads the assignment from the native SDK and fires OnABTestingAssignmentChanged when it differs from the cache
+    static void refreshABTestingAssignment();
+    // Fired when a fresh A/B testing assignment arrives that differs from the cached one
+    static FGAOnABTestingAssignmentChanged OnABTestingAssignmentChanged;
 
     // Bluprint functions
 
@@ -386,6 +601,26 @@ public:
     UFUNCTION(BlueprintCallable, Category = "GameAnalytics")
     static FString GetRemoteConfigsContentAsString();
 
+    UFUNCTION(BlueprintCallable, Category = "GameAnalytics")
+    static TMap<FString, FString> GetRemoteConfigsContent();
+
+    static void GetRemoteConfigsValues(TArrayView<const FString> Keys, TArray<FString>& Out);
+
+    UFUNCTION(BlueprintPure, Category = "GameAnalytics")
+    static FGameAnalyticsCustomEventField MakeIntegerField(const FString& Key, int64 Value);
+
+    UFUNCTION(BlueprintPure, Category = "GameAnalytics")
+    static FGameAnalyticsCustomEventField MakeNumberField(const FString& Key, float Value);
+
+    UFUNCTION(BlueprintPure, Category = "GameAnalytics")
+    static FGameAnalyticsCustomEventField MakeBoolField(const FString& Key, bool Value);
+
+    UFUNCTION(BlueprintPure, Category = "GameAnalytics")
+    static FGameAnalyticsCustomEventField MakeStringField(const FString& Key, const FString& Value);
+
+    UFUNCTION(BlueprintPure, Category = "GameAnalytics")
+    static FGameAnalyticsCustomEventField MakeNameField(const FString& Key, FName Value);
+
     UFUNCTION(BlueprintCallable, Category = "GameAnalytics")
     static FString GetABTestingId();
 
@@ -5,6 +5,7 @@
 #include "Interfaces/IAnalyticsProviderModule.h"
 #include "CoreMinimal.h"
 #include "Misc/Paths.h"
+#include "Containers/Ticker.h"
 #include "Runtime/Launch/Resources/Version.h"
 #if (ENGINE_MAJOR_VERSION >= 4 && ENGINE_MINOR_VERSION >= 15) || (ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 0)
 #include "Modules/ModuleManager.h"
@@ -21,6 +22,20 @@ class FAnalyticsGameAnalytics :
     /** Singleton for analytics */
     TSharedPtr<IAnalyticsProvider> GameAnalyticsProvider;
 
+    /** Core ticker registration collecting the per-thread staged events */
+#if ENGINE_MAJOR_VERSION >= 5
+    FTSTicker::FDelegateHandle StagingTickerHandle;
+#else
+    FDelegateHandle StagingTickerHandle;
+#endif
+
+    /** Core ticker registration polling the mobile SDKs for remote config changes, they have no refresh callback */
+#if ENGINE_MAJOR_VERSION >= 5
+    FTSTicker::FDelegateHandle RemoteConfigsTickerHandle;
+#else
+    FDelegateHandle RemoteConfigsTickerHandle;
+#endif
+
     //--------------------------------------------------------------------------
     // Module functionality
     //--------------------------------------------------------------------------
@@ -80,6 +95,8 @@ public:
 		bool AutoDetectAppVersion;
         bool DisableDeviceInfo;
         bool UseErrorReporting;
+        bool RecordEventAsSingleDesignEvent = false;
+        bool UseDeferredInitialization = false;
         bool SubmitErrors;
         bool SubmitAverageFPS;
         bool SubmitCriticalFPS;
@@ -88,12 +105,18 @@ public:
         bool VerboseLogBuild;
     };
 
-    static FGameAnalyticsProjectSettings LoadProjectSettings();
+    /** Returns the project settings, read once per run (re-read on every call in the editor) */
+    static const FGameAnalyticsProjectSettings& LoadProjectSettings();
 
 
 private:
     virtual void StartupModule() override;
     virtual void ShutdownModule() override;
 
+    bool TickStagedEvents(float DeltaTime);
+    bool TickRemoteConfigs(float DeltaTime);
+
+    static FGameAnalyticsProjectSettings ReadProjectSettings();
+
     static FORCEINLINE FString GetIniName() { return FString::Printf(TEXT("%sDefaultEngine.ini"), *FPaths::SourceConfigDir()); }
 };
@@ -118,6 +118,18 @@ public:
     UPROPERTY(Config, EditAnywhere, Category = Advanced, Meta = (ToolTip = "Use automatic error reporting."))
     bool UseErrorReporting = true;
 
+    // Record event as a single design event
+    UPROPERTY(Config, EditAnywhere, Category = Advanced, Meta = (ToolTip = "Send each IAnalyticsProvider::RecordEvent call as one design event named after the event, with its attributes as custom fields, instead of one design event per attribute."))
+    bool RecordEventAsSingleDesignEvent = false;
+
+    // Deferred initialization
+    UPROPERTY(Config, EditAnywhere, Category = Advanced, Meta = (ToolTip = "Apply the configuration and initialize GameAnalytics on a worker thread instead of the game thread. Events recorded before initialization completes are held back and submitted afterwards."))
+    bool UseDeferredInitialization = false;
+
+    // Bake settings into binary
+    UPROPERTY(Config, EditAnywhere, Category = Advanced, Meta = (ToolTip = "Compile the settings of the target platform into packaged builds instead of reading them from config at startup. Changing any setting requires a rebuild of the GameAnalytics module."))
+    bool BakeSettingsIntoBinary = false;
+
     // Submit Errors
     //UPROPERTY(Config, EditAnywhere, Category=Advanced)
     //bool SubmitErrors = true;